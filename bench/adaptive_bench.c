@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+
+/**
+ * @file adaptive_bench.c
+ * @brief Benchmark of the adaptive layout against the layouts it moves between.
+ *
+ * This program builds a list by appending, reads it at random indices, and
+ * then uses it as a queue, with linked_list_pop_front and linked_list_append.
+ * The linked layout suffers in the second phase and the array layout in the
+ * third, while the adaptive layout should approach the better of the two in
+ * each phase, at the cost of the moves reported by its statistics.
+ *
+ * @date 2026-10-16
+ **/
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void phases(const char *name, const list_layout_t layout, const int size, const int ops)
+{
+  const list_options_t options = { .fun = int_eq, .layout = layout };
+  list_t *list = linked_list_create_with(&options);
+  unsigned int state = 1;
+  int sum = 0;
+
+  double start = now_ns();
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  const double build = (now_ns() - start) / size;
+
+  start = now_ns();
+  for (int i = 0; i < ops; ++i)
+    {
+      state = state * 1103515245 + 12345;
+      sum += linked_list_get(list, (state >> 1) % size).i;
+    }
+  const double get = (now_ns() - start) / ops;
+
+  start = now_ns();
+  for (int i = 0; i < ops; ++i)
+    {
+      linked_list_append(list, linked_list_pop_front(list));
+    }
+  const double queue = (now_ns() - start) / ops;
+
+  list_adaptive_stats_t stats = { .to_array = 0, .to_linked = 0 };
+  linked_list_adaptive_stats(list, &stats);
+  printf("%-8s size=%-7d append %6.1f ns/op  get %9.1f ns/op  pop_front+append %9.1f ns/op"
+         "  moves %zu/%zu  (checksum %d)\n",
+         name, size, build, get, queue, stats.to_array, stats.to_linked, sum & 1);
+  linked_list_destroy(list);
+}
+
+int main(void)
+{
+  const int sizes[] = { 1000, 20000 };
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      phases("linked", LIST_LAYOUT_LINKED, sizes[i], 100000);
+      phases("array", LIST_LAYOUT_ARRAY, sizes[i], 100000);
+      phases("adaptive", LIST_LAYOUT_ADAPTIVE, sizes[i], 100000);
+    }
+
+  return 0;
+}
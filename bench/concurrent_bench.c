@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "linked_list.h"
+#include "concurrent_list.h"
+
+/**
+ * @file concurrent_bench.c
+ * @brief Scaling benchmark of the concurrent list against a list behind one global mutex.
+ *
+ * This program runs the same mix of operations on a growing number of threads:
+ * every thread appends, removes elements at the front and in the middle, and
+ * now and then scans the list with contains. The throughput of a concurrent
+ * list is compared to that of a plain list whose every call is wrapped in one
+ * global mutex.
+ *
+ * @date 2026-10-16
+ **/
+
+/// Total number of operations per measurement, shared between the threads.
+#define TOTAL_OPS 400000
+/// Number of elements in the list when a measurement starts.
+#define INITIAL_SIZE 256
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/// Work of a single thread.
+typedef struct worker
+{
+  list_t *list;                 // Plain list, used when concurrent is NULL.
+  pthread_mutex_t *lock;        // Global mutex of the plain list.
+  concurrent_list_t *concurrent;
+  int ops;
+  unsigned int state;
+} worker_t;
+
+static void *run_locked(void *arg)
+{
+  worker_t *w = arg;
+  for (int i = 0; i < w->ops; ++i)
+    {
+      w->state = w->state * 1103515245 + 12345;
+      const unsigned int choice = (w->state >> 16) % 64;
+      pthread_mutex_lock(w->lock);
+      if (choice < 30)
+        {
+          linked_list_append(w->list, int_elem(i));
+        }
+      else if (choice < 58)
+        {
+          linked_list_remove(w->list, 0);
+        }
+      else if (choice < 63)
+        {
+          linked_list_remove(w->list, (int)(linked_list_size(w->list) / 2));
+        }
+      else
+        {
+          linked_list_contains(w->list, int_elem(-1));
+        }
+      pthread_mutex_unlock(w->lock);
+    }
+  return NULL;
+}
+
+static void *run_concurrent(void *arg)
+{
+  worker_t *w = arg;
+  for (int i = 0; i < w->ops; ++i)
+    {
+      w->state = w->state * 1103515245 + 12345;
+      const unsigned int choice = (w->state >> 16) % 64;
+      if (choice < 30)
+        {
+          concurrent_list_append(w->concurrent, int_elem(i));
+        }
+      else if (choice < 58)
+        {
+          concurrent_list_pop_front(w->concurrent, NULL);
+        }
+      else if (choice < 63)
+        {
+          concurrent_list_remove(w->concurrent, (int)(concurrent_list_size(w->concurrent) / 2), NULL);
+        }
+      else
+        {
+          concurrent_list_contains(w->concurrent, int_elem(-1));
+        }
+    }
+  return NULL;
+}
+
+static double measure(const bool concurrent, const int threads)
+{
+  pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+  list_t *list = linked_list_create(int_eq);
+  concurrent_list_t *clist = concurrent_list_create(int_eq);
+  for (int i = 0; i < INITIAL_SIZE; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+      concurrent_list_append(clist, int_elem(i));
+    }
+  pthread_t ids[threads];
+  worker_t workers[threads];
+
+  const double start = now_ns();
+  for (int t = 0; t < threads; ++t)
+    {
+      workers[t] = (worker_t) { .list = list, .lock = &lock, .concurrent = concurrent ? clist : NULL,
+                                .ops = TOTAL_OPS / threads, .state = (unsigned int)t + 1 };
+      pthread_create(&ids[t], NULL, concurrent ? run_concurrent : run_locked, &workers[t]);
+    }
+  for (int t = 0; t < threads; ++t)
+    {
+      pthread_join(ids[t], NULL);
+    }
+  const double elapsed = now_ns() - start;
+
+  linked_list_destroy(list);
+  concurrent_list_destroy(clist);
+  return TOTAL_OPS / elapsed * 1e3;
+}
+
+int main(void)
+{
+  const int threads[] = { 1, 2, 4, 8, 16, 32 };
+
+  for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); ++i)
+    {
+      printf("threads=%-3d global mutex %8.2f Mops/s  concurrent list %8.2f Mops/s\n",
+             threads[i], measure(false, threads[i]), measure(true, threads[i]));
+    }
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+
+/**
+ * @file evict_bench.c
+ * @brief Benchmark of eviction sweeps that remove every element matching a predicate.
+ *
+ * This program measures the cost per element of removing one element in ten
+ * from a list, by linked_list_remove at every matching index, by
+ * iterator_remove, and by linked_list_remove_if, for each storage layout.
+ * Removal by index takes O(n^2) time for the unrolled layout, so it only runs
+ * on the smaller lists, and is reported as skipped otherwise.
+ *
+ * @date 2026-10-16
+ **/
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static bool is_evicted(const elem_t value, const void *extra)
+{
+  return value.i % *(const int *)extra == 0;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static list_t *fill(const list_options_t *options, const int size)
+{
+  list_t *list = linked_list_create_with(options);
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  return list;
+}
+
+static void sweep(const char *name, const list_options_t *options, const int size)
+{
+  const int every = 10;
+  char by_index[32] = "skipped";
+  if (size <= 100000)
+    {
+      list_t *list = fill(options, size);
+      const double start = now_ns();
+      for (int i = 0; i < (int)linked_list_size(list);)
+        {
+          if (is_evicted(linked_list_get(list, i), &every))
+            {
+              linked_list_remove(list, i);
+            }
+          else
+            {
+              ++i;
+            }
+        }
+      snprintf(by_index, sizeof(by_index), "%.2f ns/elem", (now_ns() - start) / size);
+      linked_list_destroy(list);
+    }
+
+  list_t *list = fill(options, size);
+  double start = now_ns();
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  while (iterator_has_next(iter))
+    {
+      if (is_evicted(iterator_current(iter), &every))
+        {
+          iterator_remove(iter);
+        }
+      else
+        {
+          iterator_next(iter);
+        }
+    }
+  const double by_iterator = (now_ns() - start) / size;
+  linked_list_destroy(list);
+
+  list = fill(options, size);
+  start = now_ns();
+  const size_t removed = linked_list_remove_if(list, is_evicted, &every);
+  const double by_predicate = (now_ns() - start) / size;
+  linked_list_destroy(list);
+
+  printf("%-9s size=%-8d removed=%-7zu remove(i) %16s  iterator %6.2f ns/elem  remove_if %6.2f ns/elem\n",
+         name, size, removed, by_index, by_iterator, by_predicate);
+}
+
+int main(void)
+{
+  const list_options_t linked = { .fun = int_eq };
+  const list_options_t pooled = { .fun = int_eq, .private_pool = true };
+  const list_options_t unrolled = { .fun = int_eq, .layout = LIST_LAYOUT_UNROLLED };
+  const int sizes[] = { 100000, 5000000 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+      sweep("linked", &linked, sizes[s]);
+      sweep("pooled", &pooled, sizes[s]);
+      sweep("unrolled", &unrolled, sizes[s]);
+    }
+
+  return 0;
+}
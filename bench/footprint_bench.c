@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <malloc.h>
+#include <time.h>
+#include "linked_list.h"
+
+/**
+ * @file footprint_bench.c
+ * @brief Benchmark of the memory taken per element by every layout.
+ *
+ * This program fills a list of each layout by appending, and reports the heap
+ * memory in use per element according to mallinfo2, which includes the malloc
+ * overhead of every block, together with the cost of appending and of a scan
+ * by linked_list_contains for an element that is not in the list.
+ *
+ * @date 2026-10-16
+ **/
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static size_t heap_in_use(void)
+{
+  const struct mallinfo2 info = mallinfo2();
+  return info.uordblks + info.hblkhd;
+}
+
+static void footprint(const char *name, const list_options_t *options, const int size)
+{
+  const size_t before = heap_in_use();
+  double start = now_ns();
+  list_t *list = linked_list_create_with(options);
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  const double append = (now_ns() - start) / size;
+  const double bytes = (double)(heap_in_use() - before) / size;
+
+  start = now_ns();
+  const bool found = linked_list_contains(list, int_elem(-1));
+  const double scan = (now_ns() - start) / size;
+
+  printf("%-9s size=%-10d %6.1f bytes/elem  append %6.1f ns/op  contains %6.2f ns/elem  (found %d)\n",
+         name, size, bytes, append, scan, found);
+  linked_list_destroy(list);
+}
+
+int main(void)
+{
+  const list_options_t linked = { .eq_kind = LIST_EQ_INT };
+  const list_options_t pooled = { .eq_kind = LIST_EQ_INT, .private_pool = true };
+  const list_options_t unrolled = { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_UNROLLED };
+  const list_options_t array = { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_ARRAY };
+  const list_options_t compact = { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_COMPACT };
+  const int sizes[] = { 100000, 10000000 };
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      footprint("linked", &linked, sizes[i]);
+      footprint("pooled", &pooled, sizes[i]);
+      footprint("unrolled", &unrolled, sizes[i]);
+      footprint("array", &array, sizes[i]);
+      footprint("compact", &compact, sizes[i]);
+    }
+
+  return 0;
+}
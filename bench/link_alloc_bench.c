@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "pool.h"
+
+/**
+ * @file link_alloc_bench.c
+ * @brief Benchmark of link allocation with malloc versus a pool.
+ *
+ * This program measures the cost per operation of filling a list and then
+ * churning it with append/remove pairs, for a list using malloc for every
+ * link, a list with a private pool and two lists sharing one pool. It also
+ * compares loading a list one element at a time with loading it in bulk, and
+ * the cost of request-scoped lists that are built, scanned and torn down.
+ *
+ * @date 2026-10-16
+ **/
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void churn(const char *name, list_t *list, const int size, const int rounds)
+{
+  double start = now_ns();
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  const double fill = (now_ns() - start) / size;
+
+  start = now_ns();
+  for (int i = 0; i < rounds; ++i)
+    {
+      linked_list_remove(list, 0);
+      linked_list_append(list, int_elem(i));
+    }
+  const double cycle = (now_ns() - start) / rounds;
+
+  start = now_ns();
+  linked_list_clear(list);
+  const double clear = (now_ns() - start) / size;
+
+  printf("%-8s size=%-9d append %7.2f ns/op  remove+append %7.2f ns/op  clear %7.2f ns/op\n",
+         name, size, fill, cycle, clear);
+}
+
+static void load(const char *name, const bool pooled, const int size)
+{
+  elem_t *values = calloc(size, sizeof(elem_t));
+  for (int i = 0; i < size; ++i)
+    {
+      values[i] = int_elem(i);
+    }
+
+  list_t *list = pooled ? linked_list_create_pooled(int_eq, NULL) : linked_list_create(int_eq);
+  double start = now_ns();
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, values[i]);
+    }
+  const double single = (now_ns() - start) / size;
+  linked_list_destroy(list);
+
+  list = pooled ? linked_list_create_pooled(int_eq, NULL) : linked_list_create(int_eq);
+  start = now_ns();
+  linked_list_append_array(list, values, size);
+  const double bulk = (now_ns() - start) / size;
+  linked_list_destroy(list);
+
+  printf("%-8s size=%-9d append loop %7.2f ns/elem  append_array %7.2f ns/elem\n",
+         name, size, single, bulk);
+  free(values);
+}
+
+/// Build, scan and tear down a list per request, with malloc, a private pool or an arena.
+static void requests(const char *name, arena_t *arena, const bool pooled, const int size, const int count)
+{
+  const int missing = -1;
+  const double start = now_ns();
+  for (int r = 0; r < count; ++r)
+    {
+      list_t *list = arena ? linked_list_create_in_arena(arena, int_eq)
+        : pooled ? linked_list_create_pooled(int_eq, NULL) : linked_list_create(int_eq);
+      for (int i = 0; i < size; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+        }
+      if (linked_list_contains(list, int_elem(missing)))
+        {
+          puts("Unexpected element!");
+        }
+      if (arena)
+        {
+          arena_reset(arena);
+        }
+      else
+        {
+          linked_list_destroy(list);
+        }
+    }
+  const double per_element = (now_ns() - start) / ((double)size * count);
+
+  printf("%-8s size=%-9d request %7.2f ns/elem\n", name, size, per_element);
+}
+
+int main(void)
+{
+  const int sizes[] = { 1000, 100000, 1000000 };
+  const int rounds = 1000000;
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      list_t *list = linked_list_create(int_eq);
+      churn("malloc", list, sizes[i], rounds);
+      linked_list_destroy(list);
+
+      list = linked_list_create_pooled(int_eq, NULL);
+      churn("private", list, sizes[i], rounds);
+      linked_list_destroy(list);
+
+      pool_t *pool = linked_list_pool_create(4096);
+      list_t *other = linked_list_create_pooled(int_eq, pool);
+      list = linked_list_create_pooled(int_eq, pool);
+      churn("shared", list, sizes[i], rounds);
+      churn("shared", other, sizes[i], rounds);
+      linked_list_destroy(list);
+      linked_list_destroy(other);
+      pool_destroy(pool);
+    }
+  load("malloc", false, 10000000);
+  load("private", true, 10000000);
+
+  arena_t *arena = arena_create(0);
+  const int request_sizes[] = { 100, 10000 };
+  for (size_t i = 0; i < sizeof(request_sizes) / sizeof(request_sizes[0]); ++i)
+    {
+      const int count = 10000000 / request_sizes[i];
+      requests("malloc", NULL, false, request_sizes[i], count);
+      requests("private", NULL, true, request_sizes[i], count);
+      requests("arena", arena, false, request_sizes[i], count);
+    }
+  arena_destroy(arena);
+
+  return 0;
+}
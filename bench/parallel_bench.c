@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+#include "thread_pool.h"
+
+/**
+ * @file parallel_bench.c
+ * @brief Benchmark of the parallel list operations against their sequential counterparts.
+ *
+ * This program applies an expensive function to every element of a list, and
+ * tests an expensive predicate with all and any, first with the sequential
+ * functions and then with the parallel ones on pools of a growing number of
+ * threads. The predicate of any holds for an element in the middle of the
+ * list, which shows the effect of stopping early.
+ *
+ * @date 2026-10-16
+ **/
+
+/// Number of elements in the list.
+#define SIZE 100000
+/// Number of rounds of busy work per call of a callback, roughly a microsecond.
+#define WORK 1000
+
+static double now_ms(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static unsigned int busy_work(const unsigned int seed)
+{
+  volatile unsigned int state = seed;
+  for (int i = 0; i < WORK; ++i)
+    {
+      state = state * 1103515245 + 12345;
+    }
+  return state;
+}
+
+static void expensive_update(elem_t *value, const void *extra)
+{
+  (void)extra;
+  value->u = (value->u & 0xfffff) | (busy_work(value->u) & 0xfff00000u);
+}
+
+static bool expensive_equals(const elem_t value, const void *extra)
+{
+  busy_work(value.u);
+  return (value.u & 0xfffff) == *(const unsigned int *)extra;
+}
+
+static bool expensive_differs(const elem_t value, const void *extra)
+{
+  return !expensive_equals(value, extra);
+}
+
+static void measure(list_t *list, thread_pool_t *pool, const char *name)
+{
+  const unsigned int middle = SIZE / 2;
+  const unsigned int missing = 0xfffff;
+  double start = now_ms();
+  if (pool == NULL)
+    {
+      linked_list_apply_to_all(list, expensive_update, NULL);
+    }
+  else
+    {
+      linked_list_parallel_apply_to_all(list, pool, expensive_update, NULL);
+    }
+  const double apply = now_ms() - start;
+
+  start = now_ms();
+  const bool all = pool ? linked_list_parallel_all(list, pool, expensive_differs, &missing)
+                        : linked_list_all(list, expensive_differs, &missing);
+  const double all_time = now_ms() - start;
+
+  start = now_ms();
+  const bool any = pool ? linked_list_parallel_any(list, pool, expensive_equals, &middle)
+                        : linked_list_any(list, expensive_equals, &middle);
+  const double any_time = now_ms() - start;
+
+  printf("%-12s apply %9.2f ms  all %9.2f ms (%d)  any %9.2f ms (%d)\n",
+         name, apply, all_time, all, any_time, any);
+}
+
+int main(void)
+{
+  list_t *list = linked_list_create(NULL);
+  for (unsigned int i = 0; i < SIZE; ++i)
+    {
+      linked_list_append(list, unsigned_int_elem(i));
+    }
+
+  measure(list, NULL, "sequential");
+  const size_t workers[] = { 0, 1, 3, 7 };
+  for (size_t i = 0; i < sizeof(workers) / sizeof(workers[0]); ++i)
+    {
+      thread_pool_t *pool = thread_pool_create(workers[i]);
+      char name[32];
+      snprintf(name, sizeof(name), "threads=%zu", thread_pool_threads(pool));
+      measure(list, pool, name);
+      thread_pool_destroy(pool);
+    }
+
+  linked_list_destroy(list);
+  return 0;
+}
@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "linked_list.h"
+
+/**
+ * @file persist_bench.c
+ * @brief Benchmark of starting up with a saved list rather than rebuilding it.
+ *
+ * This program compares rebuilding a list by appending every element with
+ * opening a file written by linked_list_save, which maps the file instead of
+ * reading it. It reports the time to have a usable list, and the cost of the
+ * first and second scans by linked_list_contains, since the first scan of a
+ * mapped list takes its pages from the page cache. It also compares writing a
+ * list to a file descriptor one element at a time with linked_list_write_fd,
+ * and reading it back with linked_list_read_fd.
+ *
+ * @date 2026-10-16
+ **/
+
+/// File that the saved lists are written to.
+#define PERSIST_PATH "persist_bench.lst"
+/// Largest list that is also written one element at a time, for comparison.
+#define PERSIST_WRITE_PER_ELEMENT_MAX 1000000
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void report(const char *name, list_t *list, const int size, const double ready)
+{
+  double start = now_ns();
+  bool found = linked_list_contains(list, int_elem(-1));
+  const double first = (now_ns() - start) / size;
+  start = now_ns();
+  found |= linked_list_contains(list, int_elem(-1));
+  const double second = (now_ns() - start) / size;
+  printf("%-10s size=%-10d ready %10.3f ms  first scan %5.2f ns/elem  second scan %5.2f ns/elem  (found %d)\n",
+         name, size, ready / 1e6, first, second, found);
+}
+
+static void startup(const int size)
+{
+  const list_options_t options = { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_COMPACT };
+  double start = now_ns();
+  list_t *list = linked_list_create_with(&options);
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  report("rebuild", list, size, now_ns() - start);
+
+  // One system call per element takes seconds for large lists, so the baseline only runs for small ones.
+  if (size <= PERSIST_WRITE_PER_ELEMENT_MAX)
+    {
+      start = now_ns();
+      const int fd = open(PERSIST_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      list_iterator_t *iter = list_iterator(list);
+      while (iterator_has_next(iter))
+        {
+          const elem_t value = iterator_next(iter);
+          if (write(fd, &value, sizeof(value)) != sizeof(value))
+            {
+              break;
+            }
+        }
+      iterator_destroy(iter);
+      close(fd);
+      printf("%-10s size=%-10d %16.3f ms\n", "write/elem", size, (now_ns() - start) / 1e6);
+    }
+
+  start = now_ns();
+  int fd = open(PERSIST_PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  linked_list_write_fd(list, fd);
+  close(fd);
+  printf("%-10s size=%-10d %16.3f ms\n", "write_fd", size, (now_ns() - start) / 1e6);
+
+  start = now_ns();
+  fd = open(PERSIST_PATH, O_RDONLY);
+  list_t *read = linked_list_read_fd(fd, NULL);
+  close(fd);
+  report("read_fd", read, size, now_ns() - start);
+  linked_list_destroy(read);
+
+  start = now_ns();
+  linked_list_save(list, PERSIST_PATH);
+  const double save = now_ns() - start;
+  linked_list_destroy(list);
+  printf("%-10s size=%-10d %16.3f ms\n", "save", size, save / 1e6);
+
+  start = now_ns();
+  list = linked_list_open_mmap(PERSIST_PATH, NULL);
+  report("open_mmap", list, size, now_ns() - start);
+  linked_list_destroy(list);
+  remove(PERSIST_PATH);
+}
+
+int main(void)
+{
+  const int sizes[] = { 100000, 10000000 };
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      startup(sizes[i]);
+    }
+
+  return 0;
+}
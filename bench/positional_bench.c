@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+
+/**
+ * @file positional_bench.c
+ * @brief Benchmark of random positional access with and without a skip index.
+ *
+ * This program measures the cost per operation of linked_list_get,
+ * linked_list_insert and linked_list_remove at random indices, for a list that
+ * walks its links and a list with a skip index, as well as the cost of
+ * linked_list_get in a loop over all indices, which resumes from the cursor.
+ *
+ * @date 2026-10-16
+ **/
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void positional(const char *name, const bool skip_index, const int size)
+{
+  const list_options_t options = { .fun = int_eq, .skip_index = skip_index, .private_pool = true };
+  list_t *list = linked_list_create_with(&options);
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  // Keep the walking list to roughly 2 * 10^8 link steps per operation kind.
+  const int ops = skip_index ? 100000 : (int)(size < 2000 ? 100000 : 200000000LL / size);
+  unsigned int state = 1;
+  int sum = 0;
+
+  double start = now_ns();
+  for (int i = 0; i < ops; ++i)
+    {
+      state = state * 1103515245 + 12345;
+      sum += linked_list_get(list, (state >> 1) % size).i;
+    }
+  const double get = (now_ns() - start) / ops;
+
+  start = now_ns();
+  for (int i = 0; i < ops; ++i)
+    {
+      state = state * 1103515245 + 12345;
+      linked_list_insert(list, (state >> 1) % size, int_elem(i));
+      state = state * 1103515245 + 12345;
+      linked_list_remove(list, (state >> 1) % size);
+    }
+  const double churn = (now_ns() - start) / ops;
+
+  start = now_ns();
+  for (int i = 0; i < size; ++i)
+    {
+      sum += linked_list_get(list, i).i;
+    }
+  const double sequential = (now_ns() - start) / size;
+
+  printf("%-5s size=%-9d get %10.1f ns/op  insert+remove %10.1f ns/op  sequential get %6.1f ns/op  (checksum %d)\n",
+         name, size, get, churn, sequential, sum & 1);
+  linked_list_destroy(list);
+}
+
+int main(void)
+{
+  const int sizes[] = { 1000, 100000, 10000000 };
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      positional("walk", false, sizes[i]);
+      positional("skip", true, sizes[i]);
+    }
+
+  return 0;
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "linked_list.h"
+#include "concurrent_list.h"
+#include "lockfree_queue.h"
+
+/**
+ * @file queue_bench.c
+ * @brief Scaling benchmark of the lock-free queue against the locking lists.
+ *
+ * This program runs pairs of producer and consumer threads that hand elements
+ * over through a FIFO queue: producers append at the end and consumers remove
+ * at the front. The throughput of the lock-free queue is compared to that of a
+ * plain list whose every call is wrapped in one global mutex, and to that of
+ * the concurrent list.
+ *
+ * @date 2026-10-16
+ **/
+
+/// Total number of elements handed over per measurement, shared between the producers.
+#define TOTAL_OPS 400000
+
+/// Queue implementation being measured.
+typedef enum kind
+{
+  KIND_LOCKED,
+  KIND_CONCURRENT,
+  KIND_LOCKFREE
+} kind_t;
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/// Work of a single thread.
+typedef struct worker
+{
+  kind_t kind;
+  list_t *list;                 // Plain list, used with KIND_LOCKED.
+  pthread_mutex_t *lock;        // Global mutex of the plain list.
+  concurrent_list_t *concurrent;
+  lockfree_queue_t *queue;
+  int ops;                      // Number of elements to append or remove.
+} worker_t;
+
+static void *produce(void *arg)
+{
+  worker_t *w = arg;
+  for (int i = 0; i < w->ops; ++i)
+    {
+      switch (w->kind)
+        {
+        case KIND_LOCKED:
+          pthread_mutex_lock(w->lock);
+          linked_list_append(w->list, int_elem(i));
+          pthread_mutex_unlock(w->lock);
+          break;
+        case KIND_CONCURRENT:
+          concurrent_list_append(w->concurrent, int_elem(i));
+          break;
+        case KIND_LOCKFREE:
+          lockfree_queue_append(w->queue, int_elem(i));
+          break;
+        }
+    }
+  return NULL;
+}
+
+static void *consume(void *arg)
+{
+  worker_t *w = arg;
+  int removed = 0;
+  while (removed < w->ops)
+    {
+      bool success = false;
+      switch (w->kind)
+        {
+        case KIND_LOCKED:
+          pthread_mutex_lock(w->lock);
+          success = !linked_list_is_empty(w->list);
+          if (success)
+            {
+              linked_list_pop_front(w->list);
+            }
+          pthread_mutex_unlock(w->lock);
+          break;
+        case KIND_CONCURRENT:
+          success = concurrent_list_pop_front(w->concurrent, NULL);
+          break;
+        case KIND_LOCKFREE:
+          success = lockfree_queue_pop_front(w->queue, NULL);
+          break;
+        }
+      removed += success;
+    }
+  return NULL;
+}
+
+static double measure(const kind_t kind, const int pairs)
+{
+  pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+  list_t *list = linked_list_create(NULL);
+  concurrent_list_t *clist = concurrent_list_create(NULL);
+  lockfree_queue_t *queue = lockfree_queue_create();
+  pthread_t ids[2 * pairs];
+  worker_t workers[pairs];
+
+  const double start = now_ns();
+  for (int t = 0; t < pairs; ++t)
+    {
+      workers[t] = (worker_t) { .kind = kind, .list = list, .lock = &lock, .concurrent = clist,
+                                .queue = queue, .ops = TOTAL_OPS / pairs };
+      pthread_create(&ids[2 * t], NULL, produce, &workers[t]);
+      pthread_create(&ids[2 * t + 1], NULL, consume, &workers[t]);
+    }
+  for (int t = 0; t < 2 * pairs; ++t)
+    {
+      pthread_join(ids[t], NULL);
+    }
+  const double elapsed = now_ns() - start;
+
+  linked_list_destroy(list);
+  concurrent_list_destroy(clist);
+  lockfree_queue_destroy(queue);
+  return TOTAL_OPS / elapsed * 1e3;
+}
+
+int main(void)
+{
+  const int pairs[] = { 1, 2, 4, 8, 16 };
+
+  for (size_t i = 0; i < sizeof(pairs) / sizeof(pairs[0]); ++i)
+    {
+      printf("pairs=%-3d global mutex %8.2f Mops/s  concurrent list %8.2f Mops/s  lock-free queue %8.2f Mops/s\n",
+             pairs[i], measure(KIND_LOCKED, pairs[i]), measure(KIND_CONCURRENT, pairs[i]),
+             measure(KIND_LOCKFREE, pairs[i]));
+    }
+
+  return 0;
+}
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+
+/**
+ * @file rebalance_bench.c
+ * @brief Benchmark of moving batches of elements between lists.
+ *
+ * This program measures the cost of moving the last batch of elements of one
+ * list to the end of another and back, by copying the elements one at a time,
+ * by linked_list_split_at followed by linked_list_concat, and by
+ * iterator_splice. The lists are doubly linked, so that the batch is found by
+ * walking back from the end of the list.
+ *
+ * @date 2026-10-16
+ **/
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/// Move the last batch elements of from to the end of to, one element at a time.
+static void move_by_copy(list_t *from, list_t *to, const int batch)
+{
+  const int start = (int)linked_list_size(from) - batch;
+  for (int i = 0; i < batch; ++i)
+    {
+      linked_list_append(to, linked_list_remove(from, start));
+    }
+}
+
+/// Move the last batch elements of from to the end of to, by splitting and concatenating.
+static void move_by_split(list_t *from, list_t *to, const int batch)
+{
+  list_t *tail = linked_list_split_at(from, -batch);
+  linked_list_concat(to, tail);
+  linked_list_destroy(tail);
+}
+
+/// Move the last batch elements of from to the end of to, by splicing.
+static void move_by_splice(list_t *from, list_t *to, const int batch)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, to);
+  iterator_to_end(iter);
+  list_iterator_storage_t source_storage;
+  list_iterator_t *source = list_iterator_init(&source_storage, from);
+  iterator_to_end(source);
+  for (int i = 0; i < batch; ++i)
+    {
+      iterator_previous(source);
+    }
+  iterator_splice(iter, source, batch);
+}
+
+static void run(const char *name, void (*move)(list_t *, list_t *, const int), const int size, const int batch,
+                const int rounds)
+{
+  const list_options_t options = { .fun = int_eq, .doubly_linked = true };
+  list_t *left = linked_list_create_with(&options);
+  list_t *right = linked_list_create_with(&options);
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(left, int_elem(i));
+      linked_list_append(right, int_elem(i));
+    }
+
+  const double start = now_ns();
+  for (int i = 0; i < rounds; ++i)
+    {
+      move(left, right, batch);
+      move(right, left, batch);
+    }
+  const double per_move = (now_ns() - start) / (2.0 * rounds);
+
+  printf("%-7s size=%-8d batch=%-6d %12.1f ns/move  %8.2f ns/elem\n", name, size, batch, per_move,
+         per_move / batch);
+  linked_list_destroy(left);
+  linked_list_destroy(right);
+}
+
+int main(void)
+{
+  const int sizes[] = { 1000, 100000 };
+  const int batches[] = { 16, 256 };
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+      for (size_t b = 0; b < sizeof(batches) / sizeof(batches[0]); ++b)
+        {
+          const int rounds = 2000000 / (sizes[s] + batches[b]) + 10;
+          run("copy", move_by_copy, sizes[s], batches[b], rounds);
+          run("split", move_by_split, sizes[s], batches[b], rounds);
+          run("splice", move_by_splice, sizes[s], batches[b], rounds);
+        }
+    }
+
+  return 0;
+}
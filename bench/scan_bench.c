@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linked_list.h"
+
+/**
+ * @file scan_bench.c
+ * @brief Benchmark of full list scans for the different storage layouts.
+ *
+ * This program measures the cost per element of linked_list_contains for an
+ * element that is not in the list, and of linked_list_apply_to_all, for each
+ * storage layout, with an eq_function and with the built-in int comparison.
+ *
+ * @date 2026-10-16
+ **/
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static void increment(elem_t *value, const void *extra)
+{
+  value->i += *(const int *)extra;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void scan(const char *name, const list_layout_t layout, const list_eq_kind_t eq_kind, const int size)
+{
+  const list_options_t options = { .fun = int_eq, .layout = layout, .eq_kind = eq_kind };
+  list_t *list = linked_list_create_with(&options);
+  for (int i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  const int rounds = size < 10000000 ? 10000000 / size : 1;
+  const int step = 1;
+
+  double start = now_ns();
+  int found = 0;
+  for (int r = 0; r < rounds; ++r)
+    {
+      found += linked_list_contains(list, int_elem(-1));
+    }
+  const double contains = (now_ns() - start) / ((double)rounds * size);
+
+  start = now_ns();
+  for (int r = 0; r < rounds; ++r)
+    {
+      linked_list_apply_to_all(list, increment, &step);
+    }
+  const double apply = (now_ns() - start) / ((double)rounds * size);
+
+  printf("%-13s size=%-9d contains %6.3f ns/elem  apply_to_all %6.3f ns/elem%s\n",
+         name, size, contains, apply, found ? " (unexpected hit)" : "");
+  linked_list_destroy(list);
+}
+
+int main(void)
+{
+  const int sizes[] = { 1000, 100000, 1000000, 10000000 };
+
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+      scan("linked", LIST_LAYOUT_LINKED, LIST_EQ_CUSTOM, sizes[i]);
+      scan("linked/int", LIST_LAYOUT_LINKED, LIST_EQ_INT, sizes[i]);
+      scan("unrolled", LIST_LAYOUT_UNROLLED, LIST_EQ_CUSTOM, sizes[i]);
+      scan("unrolled/int", LIST_LAYOUT_UNROLLED, LIST_EQ_INT, sizes[i]);
+      scan("array", LIST_LAYOUT_ARRAY, LIST_EQ_CUSTOM, sizes[i]);
+      scan("array/int", LIST_LAYOUT_ARRAY, LIST_EQ_INT, sizes[i]);
+    }
+
+  return 0;
+}
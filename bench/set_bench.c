@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "linked_list.h"
+#include "iterator.h"
+#include "lockfree_set.h"
+
+/**
+ * @file set_bench.c
+ * @brief Scaling benchmark of the lock-free set against a list behind one global mutex.
+ *
+ * This program runs the same read-mostly mix of set operations on a growing
+ * number of threads: most operations look a key up with contains, the rest
+ * insert or remove a key. The throughput of the lock-free set is compared to
+ * that of a plain doubly linked list, kept sorted, whose every call is wrapped
+ * in one global mutex.
+ *
+ * @date 2026-10-16
+ **/
+
+/// Total number of operations per measurement, shared between the threads.
+#define TOTAL_OPS 400000
+/// Number of distinct keys, half of which are in the set when a measurement starts.
+#define KEY_RANGE 512
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static int int_cmp(const elem_t a, const elem_t b)
+{
+  return (a.i > b.i) - (a.i < b.i);
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/// Work of a single thread.
+typedef struct worker
+{
+  list_t *list;                 // Sorted plain list, used when set is NULL.
+  pthread_mutex_t *lock;        // Global mutex of the plain list.
+  lockfree_set_t *set;
+  int ops;
+  unsigned int state;
+} worker_t;
+
+/// Insert or remove a key in a sorted plain list, the way a set built on list_t would.
+static void locked_update(list_t *list, const int key, const bool insert)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  while (iterator_has_next(iter))
+    {
+      const int value = iterator_next(iter).i;
+      if (value == key)
+        {
+          if (!insert)
+            {
+              iterator_previous(iter);
+              iterator_remove(iter);
+            }
+          return;
+        }
+      if (value > key)
+        {
+          iterator_previous(iter);
+          break;
+        }
+    }
+  if (insert)
+    {
+      iterator_insert(iter, int_elem(key));
+    }
+}
+
+static void *run_locked(void *arg)
+{
+  worker_t *w = arg;
+  for (int i = 0; i < w->ops; ++i)
+    {
+      w->state = w->state * 1103515245 + 12345;
+      const unsigned int choice = (w->state >> 16) % 10;
+      const int key = (int)((w->state >> 4) % KEY_RANGE);
+      pthread_mutex_lock(w->lock);
+      if (choice < 8)
+        {
+          linked_list_contains(w->list, int_elem(key));
+        }
+      else
+        {
+          locked_update(w->list, key, choice == 8);
+        }
+      pthread_mutex_unlock(w->lock);
+    }
+  return NULL;
+}
+
+static void *run_lockfree(void *arg)
+{
+  worker_t *w = arg;
+  for (int i = 0; i < w->ops; ++i)
+    {
+      w->state = w->state * 1103515245 + 12345;
+      const unsigned int choice = (w->state >> 16) % 10;
+      const int key = (int)((w->state >> 4) % KEY_RANGE);
+      if (choice < 8)
+        {
+          lockfree_set_contains(w->set, int_elem(key));
+        }
+      else if (choice == 8)
+        {
+          lockfree_set_insert(w->set, int_elem(key));
+        }
+      else
+        {
+          lockfree_set_remove(w->set, int_elem(key), NULL);
+        }
+    }
+  return NULL;
+}
+
+static double measure(const bool lockfree, const int threads)
+{
+  pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+  list_t *list = linked_list_create_with(&(list_options_t) { .fun = int_eq, .doubly_linked = true });
+  lockfree_set_t *set = lockfree_set_create(int_cmp, NULL);
+  for (int key = 0; key < KEY_RANGE; key += 2)
+    {
+      linked_list_append(list, int_elem(key));
+      lockfree_set_insert(set, int_elem(key));
+    }
+  pthread_t ids[threads];
+  worker_t workers[threads];
+
+  const double start = now_ns();
+  for (int t = 0; t < threads; ++t)
+    {
+      workers[t] = (worker_t) { .list = list, .lock = &lock, .set = lockfree ? set : NULL,
+                                .ops = TOTAL_OPS / threads, .state = (unsigned int)t + 1 };
+      pthread_create(&ids[t], NULL, lockfree ? run_lockfree : run_locked, &workers[t]);
+    }
+  for (int t = 0; t < threads; ++t)
+    {
+      pthread_join(ids[t], NULL);
+    }
+  const double elapsed = now_ns() - start;
+
+  linked_list_destroy(list);
+  lockfree_set_destroy(set);
+  return TOTAL_OPS / elapsed * 1e3;
+}
+
+int main(void)
+{
+  const int threads[] = { 1, 2, 4, 8, 16, 32 };
+
+  for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); ++i)
+    {
+      printf("threads=%-3d global mutex %8.2f Mops/s  lock-free set %8.2f Mops/s\n",
+             threads[i], measure(false, threads[i]), measure(true, threads[i]));
+    }
+
+  return 0;
+}
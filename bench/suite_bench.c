@@ -0,0 +1,697 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "linked_list.h"
+#include "iterator.h"
+
+/**
+ * @file suite_bench.c
+ * @brief Benchmark suite for every function of linked_list.h and iterator.h.
+ *
+ * This program measures the time and the number of heap allocations per
+ * operation of the public functions, for every list variant, list size and
+ * access pattern, and prints the results as a JSON document on standard output:
+ *
+ *   {"suite": "linked_list", "results": [
+ *     {"function": "linked_list_get", "pattern": "random", "variant": "linked",
+ *      "size": 1000, "ops": 20000, "ns_per_op": 512.3, "allocs_per_op": 0.000},
+ *     ...]}
+ *
+ * Allocations are counted by wrapping malloc, calloc and realloc at link time
+ * (-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc). Every measurement starts
+ * from a freshly built list of the given size, whose construction is not
+ * measured. Operations whose cost grows with the size of some variant perform
+ * fewer repetitions on large lists, so that the whole suite finishes in minutes.
+ *
+ * Usage: suite_bench [max_size], where max_size limits the list sizes (default 10000000).
+ *
+ * @date 2026-10-16
+ **/
+
+/// Number of repetitions of operations that take O(1) time.
+#define BENCH_OPS 100000
+/// Number of element steps that operations taking O(n) time may spend per measurement.
+#define BENCH_LINEAR_BUDGET 20000000
+/// Number of elements added per call by the bulk insertion benchmarks.
+#define BENCH_BLOCK 64
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *pointer, size_t size);
+
+/// Number of heap allocations made since the program started.
+static size_t allocations = 0;
+
+void *__wrap_malloc(size_t size)
+{
+  ++allocations;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+  ++allocations;
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, size_t size)
+{
+  ++allocations;
+  return __real_realloc(pointer, size);
+}
+
+/// State of a single measurement.
+typedef struct bench
+{
+  list_t *list;                   // List under test, or NULL once a case has destroyed it.
+  const list_options_t *options;  // Options the list was created with.
+  size_t size;                    // Number of elements the list was built with.
+  size_t ops;                     // Number of operations to perform.
+  unsigned int state;             // State of the pseudo-random index generator.
+  double elapsed;                 // Measured time in nanoseconds.
+  size_t allocs;                  // Measured number of allocations.
+  double started;                 // Time the current measurement started.
+  size_t allocs_started;          // Allocation count when the current measurement started.
+} bench_t;
+
+/// Benchmark of one function with one access pattern.
+typedef struct bench_case
+{
+  const char *function;     // Function measured.
+  const char *pattern;      // Access pattern.
+  bool linear;              // True if an operation takes O(n) time for some variant.
+  void (*run)(bench_t *b);  // Perform b->ops operations on b->list between bench_start and bench_stop.
+} bench_case_t;
+
+/// List variant under test.
+typedef struct bench_variant
+{
+  const char *name;
+  list_options_t options;
+} bench_variant_t;
+
+static bool int_eq(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static size_t int_hash(const elem_t value)
+{
+  return (size_t)value.i * 0x9E3779B97F4A7C15ULL;
+}
+
+static bool is_not_negative(const elem_t value, const void *extra)
+{
+  (void)extra;
+  return value.i >= 0;
+}
+
+static bool is_negative(const elem_t value, const void *extra)
+{
+  (void)extra;
+  return value.i < 0;
+}
+
+static void increment(elem_t *value, const void *extra)
+{
+  value->i += *(const int *)extra;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_start(bench_t *b)
+{
+  b->allocs_started = allocations;
+  b->started = now_ns();
+}
+
+static void bench_stop(bench_t *b)
+{
+  b->elapsed += now_ns() - b->started;
+  b->allocs += allocations - b->allocs_started;
+}
+
+static int random_index(bench_t *b, const size_t bound)
+{
+  b->state = b->state * 1103515245 + 12345;
+  return bound > 0 ? (int)((b->state >> 1) % bound) : 0;
+}
+
+/// Add b->ops elements to the end of the list without measuring it, for benchmarks that remove elements.
+static void grow(bench_t *b)
+{
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_append(b->list, int_elem((int)i));
+    }
+}
+
+static void run_create_destroy(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_destroy(linked_list_create_with(b->options));
+    }
+  bench_stop(b);
+}
+
+static void run_destroy(bench_t *b)
+{
+  bench_start(b);
+  linked_list_destroy(b->list);
+  bench_stop(b);
+  b->list = NULL;
+}
+
+static void run_append(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_append(b->list, int_elem((int)i));
+    }
+  bench_stop(b);
+}
+
+static void run_prepend(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_prepend(b->list, int_elem((int)i));
+    }
+  bench_stop(b);
+}
+
+static void run_append_array(bench_t *b)
+{
+  elem_t values[BENCH_BLOCK];
+  for (int i = 0; i < BENCH_BLOCK; ++i)
+    {
+      values[i] = int_elem(i);
+    }
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_append_array(b->list, values, BENCH_BLOCK);
+    }
+  bench_stop(b);
+}
+
+static void run_prepend_array(bench_t *b)
+{
+  elem_t values[BENCH_BLOCK];
+  for (int i = 0; i < BENCH_BLOCK; ++i)
+    {
+      values[i] = int_elem(i);
+    }
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_prepend_array(b->list, values, BENCH_BLOCK);
+    }
+  bench_stop(b);
+}
+
+static void run_extend(bench_t *b)
+{
+  list_t *other = linked_list_create_with(b->options);
+  for (int i = 0; i < BENCH_BLOCK; ++i)
+    {
+      linked_list_append(other, int_elem(i));
+    }
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_extend(b->list, other);
+    }
+  bench_stop(b);
+  linked_list_destroy(other);
+}
+
+static void run_insert_random(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_insert(b->list, random_index(b, b->size + i + 1), int_elem((int)i));
+    }
+  bench_stop(b);
+}
+
+static void run_insert_sequential(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_insert(b->list, (int)((2 * i) % (b->size + i + 1)), int_elem((int)i));
+    }
+  bench_stop(b);
+}
+
+static void run_remove_random(bench_t *b)
+{
+  grow(b);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_remove(b->list, random_index(b, b->size + b->ops - i));
+    }
+  bench_stop(b);
+}
+
+static void run_remove_sequential(bench_t *b)
+{
+  grow(b);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_remove(b->list, (int)(i % (b->size + b->ops - i)));
+    }
+  bench_stop(b);
+}
+
+static void run_pop_front(bench_t *b)
+{
+  grow(b);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_pop_front(b->list);
+    }
+  bench_stop(b);
+}
+
+static void run_pop_back(bench_t *b)
+{
+  grow(b);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_pop_back(b->list);
+    }
+  bench_stop(b);
+}
+
+static void run_churn_head(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_prepend(b->list, int_elem((int)i));
+      linked_list_pop_front(b->list);
+    }
+  bench_stop(b);
+}
+
+static void run_churn_tail(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_append(b->list, int_elem((int)i));
+      linked_list_pop_back(b->list);
+    }
+  bench_stop(b);
+}
+
+static void run_get_random(bench_t *b)
+{
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += linked_list_get(b->list, random_index(b, b->size)).i;
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_get_sequential(bench_t *b)
+{
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += linked_list_get(b->list, (int)(i % b->size)).i;
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_get_tail(bench_t *b)
+{
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += linked_list_get(b->list, (int)b->size - 1).i;
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_contains_miss(bench_t *b)
+{
+  int found = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      found += linked_list_contains(b->list, int_elem(-1));
+    }
+  bench_stop(b);
+  b->state += found;
+}
+
+static void run_contains_hit(bench_t *b)
+{
+  int found = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      found += linked_list_contains(b->list, int_elem(random_index(b, b->size)));
+    }
+  bench_stop(b);
+  b->state += found;
+}
+
+static void run_size(bench_t *b)
+{
+  size_t sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += linked_list_size(b->list);
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_calculate_size(bench_t *b)
+{
+  size_t sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += linked_list_calculate_size(b->list);
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_is_empty(bench_t *b)
+{
+  size_t sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += linked_list_is_empty(b->list);
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_clear(bench_t *b)
+{
+  bench_start(b);
+  linked_list_clear(b->list);
+  bench_stop(b);
+}
+
+static void run_all(bench_t *b)
+{
+  int result = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      result += linked_list_all(b->list, is_not_negative, NULL);
+    }
+  bench_stop(b);
+  b->state += result;
+}
+
+static void run_any(bench_t *b)
+{
+  int result = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      result += linked_list_any(b->list, is_negative, NULL);
+    }
+  bench_stop(b);
+  b->state += result;
+}
+
+static void run_apply_to_all(bench_t *b)
+{
+  const int step = 1;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      linked_list_apply_to_all(b->list, increment, &step);
+    }
+  bench_stop(b);
+}
+
+static void run_iterator_create(bench_t *b)
+{
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      iterator_destroy(list_iterator(b->list));
+    }
+  bench_stop(b);
+}
+
+static void run_iterator_init(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += iterator_has_next(list_iterator_init(&storage, b->list));
+    }
+  bench_stop(b);
+  b->state += sum;
+}
+
+static void run_iterator_next(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      if (!iterator_has_next(iter))
+        {
+          iterator_reset(iter);
+        }
+      sum += iterator_next(iter).i;
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_iterator_previous(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  iterator_to_end(iter);
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      if (!iterator_has_previous(iter))
+        {
+          iterator_to_end(iter);
+        }
+      sum += iterator_previous(iter).i;
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_iterator_current(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  int sum = 0;
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      sum += iterator_current(iter).i;
+    }
+  bench_stop(b);
+  b->state += sum & 1;
+}
+
+static void run_iterator_reset(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      iterator_reset(iter);
+    }
+  bench_stop(b);
+}
+
+static void run_iterator_to_end(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      iterator_to_end(iter);
+    }
+  bench_stop(b);
+}
+
+static void run_iterator_insert(bench_t *b)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      iterator_insert(iter, int_elem((int)i));
+      iterator_next(iter);
+    }
+  bench_stop(b);
+}
+
+static void run_iterator_remove(bench_t *b)
+{
+  grow(b);
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, b->list);
+  bench_start(b);
+  for (size_t i = 0; i < b->ops; ++i)
+    {
+      if (!iterator_has_next(iter))
+        {
+          iterator_reset(iter);
+        }
+      iterator_remove(iter);
+    }
+  bench_stop(b);
+}
+
+static const bench_case_t cases[] =
+  {
+    { "linked_list_create_with+linked_list_destroy", "empty", false, run_create_destroy },
+    { "linked_list_destroy", "full", true, run_destroy },
+    { "linked_list_append", "tail", false, run_append },
+    { "linked_list_prepend", "head", false, run_prepend },
+    { "linked_list_append_array", "tail_block64", false, run_append_array },
+    { "linked_list_prepend_array", "head_block64", false, run_prepend_array },
+    { "linked_list_extend", "tail_block64", false, run_extend },
+    { "linked_list_insert", "random", true, run_insert_random },
+    { "linked_list_insert", "sequential", true, run_insert_sequential },
+    { "linked_list_remove", "random", true, run_remove_random },
+    { "linked_list_remove", "sequential", true, run_remove_sequential },
+    { "linked_list_pop_front", "head", false, run_pop_front },
+    { "linked_list_pop_back", "tail", true, run_pop_back },
+    { "linked_list_prepend+linked_list_pop_front", "head_churn", false, run_churn_head },
+    { "linked_list_append+linked_list_pop_back", "tail_churn", true, run_churn_tail },
+    { "linked_list_get", "random", true, run_get_random },
+    { "linked_list_get", "sequential", true, run_get_sequential },
+    { "linked_list_get", "tail", true, run_get_tail },
+    { "linked_list_contains", "miss", true, run_contains_miss },
+    { "linked_list_contains", "random_hit", true, run_contains_hit },
+    { "linked_list_size", "constant", false, run_size },
+    { "linked_list_calculate_size", "full", true, run_calculate_size },
+    { "linked_list_is_empty", "constant", false, run_is_empty },
+    { "linked_list_clear", "full", true, run_clear },
+    { "linked_list_all", "full", true, run_all },
+    { "linked_list_any", "full", true, run_any },
+    { "linked_list_apply_to_all", "full", true, run_apply_to_all },
+    { "list_iterator+iterator_destroy", "constant", false, run_iterator_create },
+    { "list_iterator_init+iterator_has_next", "constant", false, run_iterator_init },
+    { "iterator_has_next+iterator_next", "sequential", false, run_iterator_next },
+    { "iterator_has_previous+iterator_previous", "reverse", true, run_iterator_previous },
+    { "iterator_current", "constant", false, run_iterator_current },
+    { "iterator_reset", "constant", false, run_iterator_reset },
+    { "iterator_to_end", "constant", false, run_iterator_to_end },
+    { "iterator_insert+iterator_next", "sequential", false, run_iterator_insert },
+    { "iterator_remove", "head", false, run_iterator_remove },
+  };
+
+static const bench_variant_t variants[] =
+  {
+    { "linked", { .fun = int_eq } },
+    { "doubly", { .fun = int_eq, .doubly_linked = true } },
+    { "array", { .fun = int_eq, .layout = LIST_LAYOUT_ARRAY } },
+    { "unrolled", { .fun = int_eq, .layout = LIST_LAYOUT_UNROLLED } },
+    { "skip_index", { .fun = int_eq, .skip_index = true } },
+    { "hash_index", { .fun = int_eq, .hash = int_hash } },
+  };
+
+static list_t *build(const list_options_t *options, const size_t size)
+{
+  list_t *list = linked_list_create_with(options);
+  for (size_t i = 0; i < size; ++i)
+    {
+      linked_list_append(list, int_elem((int)i));
+    }
+  return list;
+}
+
+int main(int argc, char *argv[])
+{
+  const size_t sizes[] = { 10, 1000, 100000, 10000000 };
+  const size_t max_size = argc > 1 ? strtoul(argv[1], NULL, 10) : sizes[3];
+  const char *separator = "";
+
+  printf("{\"suite\": \"linked_list\", \"results\": [");
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]) && sizes[s] <= max_size; ++s)
+    {
+      for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v)
+        {
+          for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c)
+            {
+              const size_t size = sizes[s];
+              size_t ops = BENCH_OPS;
+              if (cases[c].linear)
+                {
+                  // The list may grow to size + ops elements, so keep ops * (size + ops) within the budget.
+                  const double n = (double)size;
+                  ops = (size_t)((sqrt(n * n + 4.0 * BENCH_LINEAR_BUDGET) - n) / 2);
+                  ops = ops < 1 ? 1 : ops > BENCH_OPS ? BENCH_OPS : ops;
+                }
+              if (cases[c].run == run_destroy || cases[c].run == run_clear)
+                {
+                  ops = 1;
+                }
+              bench_t b = { .options = &variants[v].options, .size = size, .ops = ops, .state = 1 };
+              b.list = build(b.options, size);
+              cases[c].run(&b);
+              if (b.list != NULL)
+                {
+                  linked_list_destroy(b.list);
+                }
+              printf("%s\n  {\"function\": \"%s\", \"pattern\": \"%s\", \"variant\": \"%s\", "
+                     "\"size\": %zu, \"ops\": %zu, \"ns_per_op\": %.1f, \"allocs_per_op\": %.3f, "
+                     "\"checksum\": %u}",
+                     separator, cases[c].function, cases[c].pattern, variants[v].name,
+                     size, ops, b.elapsed / ops, (double)b.allocs / ops, b.state & 1);
+              separator = ",";
+              fflush(stdout);
+            }
+        }
+    }
+  printf("\n]}\n");
+
+  return 0;
+}
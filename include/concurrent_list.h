@@ -0,0 +1,182 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "common.h"
+#include "linked_list.h"
+
+/**
+ * @file concurrent_list.h
+ * @brief Thread-safe linked list for holding generic elements.
+ *
+ * This header file defines the interface for a linked list that may be used
+ * by several threads at the same time. Every link has its own lock, and
+ * operations walk the list with hand-over-hand locking (lock coupling), where
+ * the lock of the next link is taken before the lock of the current link is
+ * released. Threads working on different parts of the list therefore proceed
+ * in parallel, and readers such as concurrent_list_contains only ever hold the
+ * lock of one or two links at a time.
+ *
+ * The end of the list is guarded by a separate tail lock, so that
+ * concurrent_list_append takes O(1) time and only waits for threads that are
+ * currently at the last link, never for a whole traversal.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ *
+ * @note All functions may be called concurrently, except concurrent_list_create
+ *       and concurrent_list_destroy, which must not overlap with any other call
+ *       on the same list. Indices refer to the state of the list at the moment
+ *       the operation reaches the position, and concurrent_list_size may lag
+ *       behind operations that are still in progress.
+ *
+ * @see linked_list.h
+ **/
+
+/// @brief Thread-safe linked list structure for holding generic elements.
+typedef struct concurrent_list concurrent_list_t;
+
+/**
+ * @brief Creates a new empty concurrent list.
+ *
+ * @param fun Function pointer for element equality comparison to store in the list.
+ * @return A pointer to an empty list, or NULL if memory allocation failed.
+ **/
+concurrent_list_t *concurrent_list_create(eq_function fun);
+
+/**
+ * @brief Destroys the concurrent list and frees its memory.
+ *
+ * This function frees all memory of the list, but not the memory of the elements.
+ * No other thread may use the list during or after the call.
+ *
+ * @param list The list to be destroyed.
+ **/
+void concurrent_list_destroy(concurrent_list_t *list);
+
+/**
+ * @brief Inserts an element at the end of the list in O(1) time.
+ *
+ * @param list The list to be appended to.
+ * @param value The value to be appended.
+ **/
+void concurrent_list_append(concurrent_list_t *list, const elem_t value);
+
+/**
+ * @brief Inserts an element at the front of the list in O(1) time.
+ *
+ * @param list The list to be prepended to.
+ * @param value The value to be prepended.
+ **/
+void concurrent_list_prepend(concurrent_list_t *list, const elem_t value);
+
+/**
+ * @brief Inserts an element into the list at a specific position in O(n) time.
+ *
+ * The valid values of index are [0, n] for a list of n elements, where 0
+ * means before the first element and n means after the last element.
+ *
+ * @param list The list to be extended.
+ * @param index The position in the list.
+ * @param value The value to be inserted.
+ * @return True if the element was inserted, false if the index was not valid.
+ **/
+bool concurrent_list_insert(concurrent_list_t *list, const int index, const elem_t value);
+
+/**
+ * @brief Removes an element from the list at a specific position in O(n) time.
+ *
+ * The valid values of index are [0, n-1] for a list of n elements.
+ *
+ * @param list The list to be modified.
+ * @param index The position in the list.
+ * @param removed Set to the removed value if it is not NULL and an element was removed.
+ * @return True if an element was removed, false if the index was not valid.
+ **/
+bool concurrent_list_remove(concurrent_list_t *list, const int index, elem_t *removed);
+
+/**
+ * @brief Removes the first element of the list in O(1) time.
+ *
+ * @param list The list to be modified.
+ * @param removed Set to the removed value if it is not NULL and an element was removed.
+ * @return True if an element was removed, false if the list was empty.
+ **/
+bool concurrent_list_pop_front(concurrent_list_t *list, elem_t *removed);
+
+/**
+ * @brief Retrieves an element from the list at a specific position in O(n) time.
+ *
+ * @param list The list to be accessed.
+ * @param index The position in the list.
+ * @param value Set to the value at the given position if the index was valid.
+ * @return True if the index was valid, false otherwise.
+ **/
+bool concurrent_list_get(concurrent_list_t *list, const int index, elem_t *value);
+
+/**
+ * @brief Checks if an element is in the list.
+ *
+ * @param list The list.
+ * @param element The element sought.
+ * @return True if the element is in the list, false otherwise.
+ **/
+bool concurrent_list_contains(concurrent_list_t *list, const elem_t element);
+
+/**
+ * @brief Gets the number of elements in the list in O(1) time.
+ *
+ * @param list The list.
+ * @return The number of elements in the list.
+ **/
+size_t concurrent_list_size(concurrent_list_t *list);
+
+/**
+ * @brief Checks if the list is empty.
+ *
+ * @param list The list.
+ * @return True if the list is empty, false otherwise.
+ **/
+bool concurrent_list_is_empty(concurrent_list_t *list);
+
+/**
+ * @brief Removes all elements from the list.
+ *
+ * @param list The list.
+ **/
+void concurrent_list_clear(concurrent_list_t *list);
+
+/**
+ * @brief Checks if a supplied property holds for all elements in the list.
+ *
+ * The function returns as soon as the result can be determined. Elements added
+ * or removed behind the position of the traversal are not taken into account.
+ *
+ * @param list The list.
+ * @param prop The property to be tested, which is called while the element is locked.
+ * @param extra An additional argument (may be NULL) that will be passed to all internal calls of prop.
+ * @return True if the property holds for all elements in the list, false otherwise.
+ **/
+bool concurrent_list_all(concurrent_list_t *list, predicate prop, const void *extra);
+
+/**
+ * @brief Checks if a supplied property holds for any element in the list.
+ *
+ * The function returns as soon as the result can be determined. Elements added
+ * or removed behind the position of the traversal are not taken into account.
+ *
+ * @param list The list.
+ * @param prop The property to be tested, which is called while the element is locked.
+ * @param extra An additional argument (may be NULL) that will be passed to all internal calls of prop.
+ * @return True if the property holds for any element in the list, false otherwise.
+ **/
+bool concurrent_list_any(concurrent_list_t *list, predicate prop, const void *extra);
+
+/**
+ * @brief Applies a supplied function to all elements in the list.
+ *
+ * @param list The list.
+ * @param fun The function to be applied, which is called while the element is locked.
+ * @param extra An additional argument (may be NULL) that will be passed to all internal calls of fun.
+ **/
+void concurrent_list_apply_to_all(concurrent_list_t *list, apply_function fun, const void *extra);
@@ -26,6 +26,21 @@
 /// @brief Iterator for a linked list.
 typedef struct iter list_iterator_t;
 
+/**
+ * @brief Caller-provided storage for an iterator.
+ *
+ * Storage of this type can be placed on the stack or inside another structure
+ * and turned into an iterator with list_iterator_init, which avoids the heap
+ * allocation made by list_iterator. Its contents are private.
+ **/
+typedef struct iter_storage
+{
+  void *opaque[6]; ///< Private iterator state.
+} list_iterator_storage_t;
+
+/// @brief Number of bytes needed to hold an iterator.
+#define LIST_ITERATOR_SIZE sizeof(list_iterator_storage_t)
+
 /**
  * @brief Checks if there are more elements to iterate over.
  * 
@@ -48,6 +63,27 @@ bool iterator_has_next(list_iterator_t *iter);
  **/
 elem_t iterator_next(list_iterator_t *iter);
 
+/**
+ * @brief Checks if there are elements before the position of the iterator.
+ *
+ * @param iter The iterator.
+ * @return True if a previous element exists, false otherwise.
+ **/
+bool iterator_has_previous(list_iterator_t *iter);
+
+/**
+ * @brief Steps the iterator backward one step.
+ *
+ * This function undoes iterator_next: it returns the element that the last
+ * call to iterator_next returned, and moves the iterator back so that the
+ * element becomes the current element again. It takes O(1) time for doubly
+ * linked lists, and O(n) time for other lists.
+ *
+ * @param iter The iterator.
+ * @return The previous element.
+ **/
+elem_t iterator_previous(list_iterator_t *iter);
+
 /**
  * @brief Removes the current element from the underlying list.
  * 
@@ -70,6 +106,24 @@ elem_t iterator_remove(list_iterator_t *iter);
  **/
 void iterator_insert(list_iterator_t *iter, const elem_t element);
 
+/**
+ * @brief Moves elements from the position of another iterator to the position of the iterator.
+ *
+ * This function moves up to count elements that follow the position of source
+ * so that they follow the position of iter, in the same order, and leaves iter
+ * after the last element moved. Fewer elements are moved if source has fewer
+ * left. The elements are relinked without any allocation when both iterators
+ * belong to lists that can share their links, as described for
+ * linked_list_concat, and copied otherwise. Both iterators may belong to the
+ * same list of the linked layout, as long as the position of iter is not
+ * among the elements moved. The time taken is O(count).
+ *
+ * @param iter The iterator that the elements are moved to.
+ * @param source The iterator that the elements are moved from.
+ * @param count The number of elements to move.
+ **/
+void iterator_splice(list_iterator_t *iter, list_iterator_t *source, const size_t count);
+
 /**
  * @brief Repositions the iterator at the start of the underlying list.
  * 
@@ -79,6 +133,16 @@ void iterator_insert(list_iterator_t *iter, const elem_t element);
  **/
 void iterator_reset(list_iterator_t *iter);
  
+/**
+ * @brief Repositions the iterator at the end of the underlying list.
+ *
+ * This function moves the iterator past the last element in the linked list,
+ * so that the list can be traversed backwards with iterator_previous.
+ *
+ * @param iter The iterator.
+ **/
+void iterator_to_end(list_iterator_t *iter);
+
 /**
  * @brief Returns the current element from the underlying list.
  * 
@@ -94,6 +158,8 @@ elem_t iterator_current(list_iterator_t *iter);
  * @brief Destroys the iterator and frees its resources.
  * 
  * This function deallocates any resources associated with the iterator.
+ * It must only be called for iterators created with list_iterator, and not
+ * for iterators initialised in caller-provided storage.
  * 
  * @param iter The iterator.
  **/
@@ -4,6 +4,9 @@
 #include <stdlib.h>
 #include "iterator.h"
 #include "common.h"
+#include "pool.h"
+#include "arena.h"
+#include "thread_pool.h"
 
 /**
  * @file linked_list.h
@@ -64,6 +67,99 @@ typedef void(*apply_function)(elem_t *value, const void *extra);
  **/
 typedef bool(*eq_function)(const elem_t a, const elem_t b);
 
+/**
+ * @brief Function pointer type for ordering two elements.
+ *
+ * This function pointer type defines a comparison function that returns a
+ * negative number, zero or a positive number as the first element is ordered
+ * before, together with or after the second element.
+ *
+ * @param a First element.
+ * @param b Second element.
+ * @return A negative, zero or positive number as a is ordered before, with or after b.
+ **/
+typedef int(*cmp_function)(const elem_t a, const elem_t b);
+
+/**
+ * @brief Function pointer type for releasing the resources of an element.
+ *
+ * This function pointer type defines a function that a list calls for every
+ * element that it discards without handing it back to the caller, for example
+ * to free the memory that a pointer element refers to.
+ *
+ * @param value Element to release.
+ **/
+typedef void(*free_function)(elem_t value);
+
+/**
+ * @brief Function pointer type for hashing an element.
+ *
+ * This function pointer type defines a hash function that maps an element to
+ * a hash value. Elements that are equal according to the eq_function of the
+ * list must have equal hash values.
+ *
+ * @param value Element to hash.
+ * @return The hash value of the element.
+ **/
+typedef size_t(*hash_function)(const elem_t value);
+
+/// @brief Built-in equality comparison of elements, which avoids calling an eq_function.
+typedef enum list_eq_kind
+{
+  LIST_EQ_CUSTOM,   ///< Compare elements with the eq_function of the list (the default).
+  LIST_EQ_INT,      ///< Compare the i members.
+  LIST_EQ_UNSIGNED, ///< Compare the u members.
+  LIST_EQ_BOOL,     ///< Compare the b members.
+  LIST_EQ_FLOAT,    ///< Compare the f members with ==, so that NaN equals nothing and 0.0 equals -0.0.
+  LIST_EQ_POINTER,  ///< Compare the p members.
+} list_eq_kind_t;
+
+/// @brief Storage layout of a linked list.
+typedef enum list_layout
+{
+  LIST_LAYOUT_LINKED,   ///< One link per element (the default).
+  LIST_LAYOUT_UNROLLED, ///< Nodes that each hold a cache line of elements.
+  LIST_LAYOUT_ARRAY,    ///< One contiguous array with a movable gap, for O(1) positional access.
+  LIST_LAYOUT_ADAPTIVE, ///< Linked or array layout, whichever suits the operations seen lately.
+  LIST_LAYOUT_COMPACT,  ///< Links of 12 bytes in growable arrays, joined by 32-bit indices.
+} list_layout_t;
+
+/// @brief Options for creating a linked list with linked_list_create_with.
+typedef struct list_options
+{
+  eq_function fun;      ///< Function pointer for element equality comparison.
+  list_layout_t layout; ///< Storage layout of the list.
+  pool_t *pool;         ///< Pool to allocate links from, or NULL (linked layout only).
+  bool private_pool;    ///< Give the list a private pool when pool is NULL (linked layout only).
+  hash_function hash;   ///< Hash function that enables a hash index for linked_list_contains, or NULL.
+  bool skip_index;      ///< Maintain a skip index for O(log n) positional access (linked layout only).
+  bool doubly_linked;   ///< Link every element back to the previous one (linked layout only).
+  list_eq_kind_t eq_kind; ///< Built-in equality comparison, which replaces fun unless LIST_EQ_CUSTOM.
+  free_function destructor; ///< Function called for every element discarded by clear, destroy, remove_if and retain_if, or NULL.
+  arena_t *arena;       ///< Arena to take the list, its links and its iterators from, or NULL (linked layout only).
+  unsigned adaptive_to_array;  ///< Percentage of positional operations that moves an adaptive list to the array layout, or 0 for 50.
+  unsigned adaptive_to_linked; ///< Percentage of positional operations that moves an adaptive list back to the linked layout, or 0 for 10.
+} list_options_t;
+
+/// @brief Counters of the work done by linked_list_all and linked_list_any, see linked_list_set_counters.
+typedef struct list_counters
+{
+  size_t predicate_calls; ///< Number of times the predicate was called.
+  size_t nodes_visited;   ///< Number of links, including compact ones, storage nodes of the unrolled layout, or array segments, visited.
+} list_counters_t;
+
+/// @brief Statistics of a list with the adaptive layout, see linked_list_adaptive_stats.
+typedef struct list_adaptive_stats
+{
+  list_layout_t layout;   ///< Layout currently used, LIST_LAYOUT_LINKED or LIST_LAYOUT_ARRAY.
+  size_t positional_ops;  ///< Accesses by position away from both ends since the last decision.
+  size_t end_ops;         ///< Accesses at either end since the last decision.
+  size_t decisions;       ///< Number of times the mix of operations was weighed.
+  size_t to_array;        ///< Number of moves from the linked layout to the array layout.
+  size_t to_linked;       ///< Number of moves from the array layout to the linked layout.
+  size_t elements_moved;  ///< Number of elements copied by all moves.
+} list_adaptive_stats_t;
+
 /**
  * @brief Creates a new empty list.
  * 
@@ -74,6 +170,110 @@ typedef bool(*eq_function)(const elem_t a, const elem_t b);
  **/
 list_t *linked_list_create(eq_function fun);
 
+/**
+ * @brief Creates a pool suitable for allocating the links of linked lists.
+ *
+ * This function creates a pool whose objects are exactly the size of a link.
+ * The pool can be shared by several lists created with linked_list_create_pooled,
+ * and must be destroyed with pool_destroy after all of them have been destroyed.
+ *
+ * @param links_per_slab Number of links per slab (0 selects a default).
+ * @return A pointer to an empty pool, or NULL if memory allocation failed.
+ **/
+pool_t *linked_list_pool_create(const size_t links_per_slab);
+
+/**
+ * @brief Creates a new empty list whose links are allocated from a pool.
+ *
+ * This function creates a new empty linked list that takes its links from a
+ * slab allocator instead of allocating each link with malloc. Removed links
+ * are recycled through the free list of the pool.
+ *
+ * @param fun Function pointer for element equality comparison to store in the list.
+ * @param pool Pool to share with other lists, or NULL to give the list a private pool
+ *             that is destroyed together with the list.
+ * @return A pointer to an empty linked list, or NULL if the pool objects are too small to hold links.
+ **/
+list_t *linked_list_create_pooled(eq_function fun, pool_t *pool);
+
+/**
+ * @brief Creates a new empty list that lives in an arena.
+ *
+ * This function creates a new empty linked list whose list structure, links
+ * and iterators made by list_iterator are all taken from an arena owned by
+ * the caller. Links removed from the list are kept by the list for reuse.
+ * Destroying or resetting the arena frees everything at once, without calling
+ * linked_list_destroy or visiting any link. linked_list_destroy may still be
+ * called, and only calls the destructor of the list, if any.
+ *
+ * @param arena The arena, which must outlive the list.
+ * @param fun Function pointer for element equality comparison to store in the list.
+ * @return A pointer to an empty linked list, or NULL if memory allocation failed.
+ **/
+list_t *linked_list_create_in_arena(arena_t *arena, eq_function fun);
+
+/**
+ * @brief Creates a new empty list with the given options.
+ *
+ * This function creates a new empty linked list with a selectable storage layout.
+ * All layouts are used through the same functions and iterators. The unrolled
+ * layout stores a cache line of elements per node, which cuts the pointer
+ * overhead and speeds up scans such as linked_list_contains, while positional
+ * operations keep their O(n) complexity. The array layout stores all elements
+ * in one gap buffer, which makes linked_list_get an O(1) operation and scans
+ * sequential reads of memory, while insertions and removals cost time
+ * proportional to their distance from the previous one. Appending, and editing
+ * through an iterator, take amortised O(1) time. The compact layout keeps the
+ * links of the linked layout in two arrays that grow by half when full, one of
+ * elements and one of 32-bit indices of the next element, so that a link takes
+ * 12 bytes rather than a malloc block and links made in a row are adjacent in
+ * memory. It holds fewer than 2^32 elements, and has the complexity of the
+ * linked layout.
+ *
+ * When a hash function is given, the list maintains a hash index counting the
+ * occurrences of its elements, which turns linked_list_contains into an expected
+ * O(1) operation at the cost of an index update on every insertion and removal.
+ * The index is rebuilt after linked_list_apply_to_all, since it may change elements.
+ *
+ * When a skip index is requested, the list keeps express lanes of an indexable
+ * skip list above its links, which turns linked_list_get, linked_list_insert and
+ * linked_list_remove into expected O(log n) operations, while linked_list_append
+ * and linked_list_prepend stay expected O(1). Changes made through an iterator
+ * cause the skip index to be rebuilt in O(n) time on the next positional access.
+ *
+ * A built-in equality comparison lets linked_list_contains compare elements in
+ * a tight loop instead of calling fun for every element, and lets the unrolled
+ * layout compare a whole node at a time.
+ *
+ * A doubly linked list stores a pointer to the previous element in every link,
+ * which makes linked_list_pop_back and iterator_previous O(1) operations at the
+ * cost of one pointer per element. Since its links are larger, a doubly linked
+ * list cannot take its links from a pool made by linked_list_pool_create, but
+ * it can be given a private pool.
+ *
+ * The adaptive layout starts out linked and counts the accesses made by
+ * linked_list_get, linked_list_insert, linked_list_remove, linked_list_append,
+ * linked_list_prepend, linked_list_pop_front and linked_list_pop_back, telling
+ * accesses at either end from accesses by position in between. Once it has
+ * counted at least one access per 16 elements, and at least 256, it weighs
+ * them: a share of positional accesses of at least adaptive_to_array percent
+ * moves the elements into the array layout, and a share of at most
+ * adaptive_to_linked percent moves them back into links. Since a move copies
+ * each element once and follows at least one access per 16 elements, moves
+ * take amortised O(1) time per access. Iterators do not survive a move, so
+ * they must not be kept across the calls above. An adaptive list cannot have
+ * a pool, a skip index or doubly linked links.
+ *
+ * A list with an arena is allocated as by linked_list_create_in_arena. It
+ * cannot have a pool, a hash index or a skip index, since these would need to
+ * be freed separately.
+ *
+ * @param options The options, where unset fields select the defaults of linked_list_create.
+ * @return A pointer to an empty linked list, or NULL if the options are invalid
+ *         or memory allocation failed.
+ **/
+list_t *linked_list_create_with(const list_options_t *options);
+
 /**
  * @brief Creates an iterator for a given list.
  * 
@@ -84,10 +284,24 @@ list_t *linked_list_create(eq_function fun);
  **/
 list_iterator_t *list_iterator(list_t *list);
 
+/**
+ * @brief Initialises an iterator for a given list in caller-provided storage.
+ *
+ * This function creates an iterator positioned at the start of the linked list
+ * without allocating any memory. The iterator lives as long as the storage and
+ * must not be passed to iterator_destroy.
+ *
+ * @param storage Storage to hold the iterator, typically a local variable.
+ * @param list List to be iterated over.
+ * @return An iterator positioned at the start of the list, pointing into storage.
+ **/
+list_iterator_t *list_iterator_init(list_iterator_storage_t *storage, list_t *list);
+
 /**
  * @brief Destroys the linked list and frees its memory.
  * 
- * This function tears down the linked list and frees all its memory, but not the memory of the elements.
+ * This function tears down the linked list and frees all its memory, but not the memory of the elements,
+ * unless the list was created with a destructor, which is then called for every element.
  * 
  * @param list The list to be destroyed.
  **/
@@ -113,6 +327,78 @@ void linked_list_append(list_t *list, const elem_t value);
  **/
 void linked_list_prepend(list_t *list, const elem_t value);
 
+/**
+ * @brief Inserts an array of elements at the end of the linked list in O(k) time.
+ *
+ * This function appends count elements to the end of the linked list, keeping
+ * their order. The new links are created and chained in a single pass before
+ * they are attached to the list. When the list takes its links from a pool,
+ * all of them are carved from a single allocation.
+ *
+ * @param list The linked list to be appended to.
+ * @param values The values to be appended.
+ * @param count The number of values.
+ **/
+void linked_list_append_array(list_t *list, const elem_t *values, const size_t count);
+
+/**
+ * @brief Inserts an array of elements at the front of the linked list in O(k) time.
+ *
+ * This function prepends count elements to the front of the linked list, keeping
+ * their order, so that values[0] becomes the first element. The links are
+ * allocated like in linked_list_append_array.
+ *
+ * @param list The linked list to be prepended to.
+ * @param values The values to be prepended.
+ * @param count The number of values.
+ **/
+void linked_list_prepend_array(list_t *list, const elem_t *values, const size_t count);
+
+/**
+ * @brief Appends all elements of another list to the end of the linked list in O(k) time.
+ *
+ * This function appends copies of the elements of other, in order, to the end
+ * of the linked list. The other list is left unchanged, and may be the list itself.
+ * The links are allocated like in linked_list_append_array.
+ *
+ * @param list The linked list to be extended.
+ * @param other The list whose elements are appended.
+ **/
+void linked_list_extend(list_t *list, list_t *other);
+
+/**
+ * @brief Moves all elements of another list to the end of the linked list.
+ *
+ * This function moves the elements of other, in order, to the end of the
+ * linked list, and leaves other empty. When both lists use the linked layout,
+ * are both singly or both doubly linked and take their links from the same
+ * place (malloc or the same shared pool), the links themselves are moved in
+ * O(1) time without any allocation. Hash indices add O(k) time for the k
+ * elements moved. Other lists have their elements copied in O(k) time.
+ *
+ * @param list The linked list to be extended.
+ * @param other The list whose elements are moved, which must not be the list itself.
+ **/
+void linked_list_concat(list_t *list, list_t *other);
+
+/**
+ * @brief Splits the linked list at a specific position.
+ *
+ * This function moves the elements from the specified index onwards to a new
+ * list created with the same options, and returns it. The valid values of
+ * index are [0, n] for a list of n elements. The links are moved without any
+ * allocation when the lists can share them as in linked_list_concat, which
+ * holds unless the list has a private pool or the unrolled layout. Finding
+ * the position takes time as in linked_list_insert, and hash indices add O(k)
+ * time for the k elements moved.
+ *
+ * @param list The linked list to be split.
+ * @param index The position of the first element to move.
+ * @return A new list holding the elements from index onwards, or NULL if the
+ *         index is invalid or memory allocation failed.
+ **/
+list_t *linked_list_split_at(list_t *list, const int index);
+
 /**
  * @brief Inserts an element into the linked list at a specific position in O(n) time.
  * 
@@ -126,6 +412,35 @@ void linked_list_prepend(list_t *list, const elem_t value);
  **/
 void linked_list_insert(list_t *list, const int index, const elem_t value);
 
+/**
+ * @brief Inserts an element into a sorted linked list in O(n) time, keeping it sorted.
+ *
+ * This function inserts the element after every element that the comparison
+ * function orders before it or together with it, so that repeated insertions
+ * keep equal elements in the order they were inserted. An element that belongs
+ * at the end is appended in O(1) time.
+ *
+ * @param list The linked list, sorted according to cmp.
+ * @param cmp The comparison function that orders the elements.
+ * @param value The value to be inserted.
+ **/
+void linked_list_insert_sorted(list_t *list, cmp_function cmp, const elem_t value);
+
+/**
+ * @brief Sorts the linked list in O(n log n) time with a stable merge sort.
+ *
+ * This function sorts the elements in the order given by the comparison
+ * function, keeping elements that are ordered together in their original
+ * order. The linked layout relinks its existing links with a bottom-up merge
+ * sort that uses O(1) extra memory and allocates nothing. The unrolled layout
+ * sorts a temporary copy of its elements, and leaves the list unchanged if
+ * that copy cannot be allocated.
+ *
+ * @param list The linked list.
+ * @param cmp The comparison function that orders the elements.
+ **/
+void linked_list_sort(list_t *list, cmp_function cmp);
+
 /**
  * @brief Removes an element from the linked list at a specific position in O(n) time.
  * 
@@ -139,12 +454,35 @@ void linked_list_insert(list_t *list, const int index, const elem_t value);
  **/
 elem_t linked_list_remove(list_t *list, const int index);
 
+/**
+ * @brief Removes the first element of the linked list in O(1) time.
+ *
+ * @param list The linked list to be modified.
+ * @return The removed value, or an element with an undefined value if the list is empty.
+ **/
+elem_t linked_list_pop_front(list_t *list);
+
+/**
+ * @brief Removes the last element of the linked list.
+ *
+ * This function takes O(1) time for doubly linked lists, and O(n) time
+ * otherwise, since the link preceding the last element has to be found.
+ *
+ * @param list The linked list to be modified.
+ * @return The removed value, or an element with an undefined value if the list is empty.
+ **/
+elem_t linked_list_pop_back(list_t *list);
+
 /**
  * @brief Retrieves an element from the linked list at a specific position in O(n) time.
  * 
  * This function retrieves an element at the specified index in the linked list.
  * The valid values of index are [0, n-1] for a list of n elements,
  * where 0 means the first element and n-1 means the last element.
+ * The list remembers the position of its last positional access, and resumes
+ * the search from there when possible, so that visiting the indices in order
+ * takes amortised O(1) time per call. The same applies to linked_list_insert
+ * and linked_list_remove.
  * 
  * @param list The linked list to be accessed.
  * @param index The position in the list.
@@ -193,10 +531,42 @@ size_t linked_list_calculate_size(list_t *list);
  **/
 bool linked_list_is_empty(list_t *list);
 
+/**
+ * @brief Removes all elements that satisfy a predicate from the linked list in O(n) time.
+ *
+ * This function tests every element once, in order, and unlinks the elements
+ * for which the predicate holds in the same pass, keeping the order of the
+ * remaining elements. Each removed link is released as soon as it is
+ * unlinked, while it is still in cache, and the destructor of the list, if
+ * any, is called for the removed element.
+ *
+ * @param list The linked list.
+ * @param prop The predicate that selects the elements to remove.
+ * @param extra Additional argument passed to the predicate.
+ * @return The number of elements removed.
+ **/
+size_t linked_list_remove_if(list_t *list, predicate prop, const void *extra);
+
+/**
+ * @brief Removes all elements that do not satisfy a predicate from the linked list in O(n) time.
+ *
+ * This function is the complement of linked_list_remove_if: it keeps the
+ * elements for which the predicate holds, in order, and removes the others.
+ *
+ * @param list The linked list.
+ * @param prop The predicate that selects the elements to keep.
+ * @param extra Additional argument passed to the predicate.
+ * @return The number of elements removed.
+ **/
+size_t linked_list_retain_if(list_t *list, predicate prop, const void *extra);
+
 /**
  * @brief Removes all elements from the linked list.
  * 
- * This function clears the linked list, removing all its elements.
+ * This function clears the linked list, removing all its elements, in a single
+ * pass that calls the destructor of the list, if any, for every element. A list
+ * with a private pool releases its links by resetting the pool, which takes
+ * O(1) time per slab rather than per link when there is no destructor.
  * 
  * @param list The linked list.
  **/
@@ -237,4 +607,153 @@ bool linked_list_any(list_t *list, predicate prop, const void *extra);
  * @param fun The function to be applied.
  * @param extra An additional argument (may be NULL) that will be passed to all internal calls of fun.
  **/
-void linked_list_apply_to_all(list_t *list, apply_function fun, const void *extra);
\ No newline at end of file
+void linked_list_apply_to_all(list_t *list, apply_function fun, const void *extra);
+
+/**
+ * @brief Attaches counters to the list that record the work done by all and any.
+ *
+ * Once counters are attached, linked_list_all, linked_list_any and their
+ * parallel variants add the number of predicate calls and visited nodes to
+ * them, which shows how early each call stopped. The counters are only added
+ * to once per call, so that they cost next to nothing, and are never reset by
+ * the list.
+ *
+ * @param list The linked list.
+ * @param counters The counters to add to, which must outlive their use by the list, or NULL to detach them.
+ **/
+void linked_list_set_counters(list_t *list, list_counters_t *counters);
+
+/**
+ * @brief Gets the statistics of a list with the adaptive layout.
+ *
+ * The statistics tell which layout the list uses, which accesses count towards
+ * the next decision, and how often the list has changed its layout so far.
+ *
+ * @param list The list.
+ * @param stats The statistics to fill in.
+ * @return True if the list has the adaptive layout, false otherwise, in which case stats is left unchanged.
+ **/
+bool linked_list_adaptive_stats(list_t *list, list_adaptive_stats_t *stats);
+
+/**
+ * @brief Checks if a supplied property holds for all elements in the list, testing them in parallel.
+ *
+ * This function splits the linked list into runs of consecutive elements and
+ * tests them on the threads of a pool. As soon as one thread finds an element
+ * for which the property does not hold, the other threads stop testing.
+ * Elements may be tested in any order and from any thread of the pool.
+ *
+ * @param list The linked list, which must not be modified during the call.
+ * @param pool The threads to test the elements on, or NULL to test them on the calling thread.
+ * @param prop The property to be tested, which must be safe to call from several threads at once.
+ * @param extra An additional argument (may be NULL) that will be passed to all internal calls of prop.
+ * @return True if the property holds for all elements in the list, false otherwise.
+ **/
+bool linked_list_parallel_all(list_t *list, thread_pool_t *pool, predicate prop, const void *extra);
+
+/**
+ * @brief Checks if a supplied property holds for any element in the list, testing them in parallel.
+ *
+ * This function splits the linked list into runs of consecutive elements and
+ * tests them on the threads of a pool. As soon as one thread finds an element
+ * for which the property holds, the other threads stop testing.
+ * Elements may be tested in any order and from any thread of the pool.
+ *
+ * @param list The linked list, which must not be modified during the call.
+ * @param pool The threads to test the elements on, or NULL to test them on the calling thread.
+ * @param prop The property to be tested, which must be safe to call from several threads at once.
+ * @param extra An additional argument (may be NULL) that will be passed to all internal calls of prop.
+ * @return True if the property holds for any element in the list, false otherwise.
+ **/
+bool linked_list_parallel_any(list_t *list, thread_pool_t *pool, predicate prop, const void *extra);
+
+/**
+ * @brief Applies a supplied function to all elements in the list in parallel.
+ *
+ * This function splits the linked list into runs of consecutive elements and
+ * applies the function to them on the threads of a pool. Every element is
+ * updated exactly once, by one thread, in any order.
+ *
+ * @param list The linked list, which must not be modified during the call.
+ * @param pool The threads to apply the function on, or NULL to apply it on the calling thread.
+ * @param fun The function to be applied, which must be safe to call from several threads at once.
+ * @param extra An additional argument (may be NULL) that will be passed to all internal calls of fun.
+ **/
+void linked_list_parallel_apply_to_all(list_t *list, thread_pool_t *pool, apply_function fun, const void *extra);
+
+/**
+ * @brief Saves the elements of a list to a file that linked_list_open_mmap can map.
+ *
+ * The file holds a header, the elements in a contiguous array of elem_t, and
+ * the links as 32-bit offsets into that array, which is the storage of the
+ * compact layout. Since links are offsets rather than pointers, the file can
+ * be mapped at any address. Elements are written as they are, so pointers
+ * stored in the list are only meaningful to the process that saved them.
+ * The list can have any layout, and is left unchanged.
+ *
+ * @param list The list to save, which must hold fewer than 2^32 - 1 elements.
+ * @param path The path of the file, which is replaced if it exists.
+ * @return True on success, false if the list is too large or the file could not be written.
+ **/
+bool linked_list_save(list_t *list, const char *path);
+
+/**
+ * @brief Opens a list saved by linked_list_save by mapping its file into memory.
+ *
+ * The list has the compact layout and uses the mapped file as its storage, so
+ * opening takes O(1) time however many elements the list holds. Pages are read
+ * from the page cache when a scan or access first touches them. The mapping is
+ * private, so the list can be changed like any other list without changing the
+ * file: changed pages are copied on first write, and all storage moves to the
+ * heap once the list needs room for more elements than the file holds. The
+ * built-in equality comparison that the saved list used, if any, is restored.
+ *
+ * Only the header is validated, to check that the slots it describes lie
+ * within the file. The links between slots are followed as they are, so a
+ * damaged or altered file can make later operations read outside the mapping.
+ * Only open files written by linked_list_save that no untrusted party could
+ * have changed.
+ *
+ * @param path The path of the file.
+ * @param fun Function pointer for element equality comparison to store in the list,
+ *            used unless the saved list had a built-in equality comparison.
+ * @return A pointer to the list, or NULL if the file could not be mapped or is
+ *         not a list file written on a machine of the same kind.
+ **/
+list_t *linked_list_open_mmap(const char *path, eq_function fun);
+
+/**
+ * @brief Writes the elements of a list to a file descriptor as a stream.
+ *
+ * The stream starts with a small header holding the number of elements and
+ * the built-in equality comparison of the list, followed by the elements as
+ * they are, in order. Elements are copied into large blocks and written with
+ * one system call per block. A list with the array layout is written without
+ * copying, with a single writev of the header and both sides of its gap.
+ * Partial writes and interrupted calls are retried, so the descriptor may be
+ * a pipe or a socket. As with linked_list_save, pointers stored in the list
+ * are only meaningful to the process that wrote them.
+ *
+ * @param list The list to write, which is left unchanged.
+ * @param fd The file descriptor to write to, at its current position.
+ * @return True on success, false if a write failed.
+ **/
+bool linked_list_write_fd(list_t *list, const int fd);
+
+/**
+ * @brief Reads a list written by linked_list_write_fd from a file descriptor.
+ *
+ * Exactly the bytes of one list are read, so that several lists can follow
+ * each other in a stream. Elements are read and appended in blocks, and a list
+ * with the linked layout takes the links for each block in one call to its
+ * allocator, which is a single bulk allocation when it has a pool. Memory is
+ * only taken for elements that have arrived, so a stream that claims more
+ * elements than it holds is rejected without allocating for the claim.
+ *
+ * @param fd The file descriptor to read from, at its current position.
+ * @param options The options to create the list with, or NULL for a linked list with
+ *                a private pool and the built-in equality comparison of the written list.
+ * @return A pointer to the list, or NULL if the options are invalid, memory allocation
+ *         failed, or the stream ended early or was not written on this kind of machine.
+ **/
+list_t *linked_list_read_fd(const int fd, const list_options_t *options);
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "common.h"
+
+/**
+ * @file lockfree_queue.h
+ * @brief Lock-free FIFO queue for holding generic elements.
+ *
+ * This header file defines the interface for a multi-producer multi-consumer
+ * queue after Michael and Scott. Like the linked list, the queue is a chain of
+ * links that starts with a sentinel link. Elements are appended at the end and
+ * removed at the front with compare-and-swap operations on C11 atomics, so that
+ * no thread ever waits for a lock held by another thread. Removed links are
+ * reclaimed with hazard pointers, so that a link is only freed once no thread
+ * can still be reading it.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ *
+ * @note All functions may be called concurrently, except lockfree_queue_create
+ *       and lockfree_queue_destroy, which must not overlap with any other call
+ *       on the same queue.
+ *
+ * @see linked_list.h
+ **/
+
+/// @brief Lock-free FIFO queue for holding generic elements.
+typedef struct lockfree_queue lockfree_queue_t;
+
+/**
+ * @brief Creates a new empty queue.
+ *
+ * @return A pointer to an empty queue, or NULL if memory allocation failed.
+ **/
+lockfree_queue_t *lockfree_queue_create(void);
+
+/**
+ * @brief Destroys the queue and frees its memory.
+ *
+ * This function frees all memory of the queue, but not the memory of the elements.
+ * No other thread may use the queue during or after the call.
+ *
+ * @param queue The queue to be destroyed.
+ **/
+void lockfree_queue_destroy(lockfree_queue_t *queue);
+
+/**
+ * @brief Inserts an element at the end of the queue.
+ *
+ * @param queue The queue to be appended to.
+ * @param value The value to be appended.
+ * @return True if the element was appended, false if memory allocation failed.
+ **/
+bool lockfree_queue_append(lockfree_queue_t *queue, const elem_t value);
+
+/**
+ * @brief Removes the first element of the queue.
+ *
+ * @param queue The queue to be modified.
+ * @param removed Set to the removed value if it is not NULL and an element was removed.
+ * @return True if an element was removed, false if the queue was empty.
+ **/
+bool lockfree_queue_pop_front(lockfree_queue_t *queue, elem_t *removed);
+
+/**
+ * @brief Gets the number of elements in the queue.
+ *
+ * The count may lag behind operations that are still in progress.
+ *
+ * @param queue The queue.
+ * @return The number of elements in the queue.
+ **/
+size_t lockfree_queue_size(lockfree_queue_t *queue);
+
+/**
+ * @brief Checks if the queue is empty.
+ *
+ * @param queue The queue.
+ * @return True if the queue is empty, false otherwise.
+ **/
+bool lockfree_queue_is_empty(lockfree_queue_t *queue);
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "common.h"
+#include "linked_list.h"
+
+/**
+ * @file lockfree_set.h
+ * @brief Lock-free ordered set for holding generic elements.
+ *
+ * This header file defines the interface for a set kept in a sorted chain of
+ * links, after Harris and Michael. Elements are ordered by a cmp_function, and
+ * elements that are ordered together are told apart by the eq_function of the
+ * set, so that the set may hold several elements with the same sort key.
+ *
+ * An element is removed in two steps: its link is first marked as deleted by
+ * setting the lowest bit of its next pointer, and then unlinked by whichever
+ * thread passes it next. Both steps are single compare-and-swap operations on
+ * C11 atomics, so no thread ever waits for a lock held by another thread.
+ * Unlinked links are reclaimed with hazard pointers.
+ *
+ * lockfree_set_contains only writes to the set when it passes a link that is
+ * marked but not yet unlinked, in which case it finishes the unlinking, so
+ * readers neither wait for each other nor for a writer that has stalled.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ *
+ * @note All functions may be called concurrently, except lockfree_set_create
+ *       and lockfree_set_destroy, which must not overlap with any other call
+ *       on the same set.
+ *
+ * @see concurrent_list.h
+ **/
+
+/// @brief Lock-free ordered set for holding generic elements.
+typedef struct lockfree_set lockfree_set_t;
+
+/**
+ * @brief Creates a new empty set.
+ *
+ * @param order Function pointer that orders the elements of the set.
+ * @param fun Function pointer for equality comparison of elements that are ordered
+ *            together, or NULL if such elements are always equal.
+ * @return A pointer to an empty set, or NULL if memory allocation failed.
+ **/
+lockfree_set_t *lockfree_set_create(cmp_function order, eq_function fun);
+
+/**
+ * @brief Destroys the set and frees its memory.
+ *
+ * This function frees all memory of the set, but not the memory of the elements.
+ * No other thread may use the set during or after the call.
+ *
+ * @param set The set to be destroyed.
+ **/
+void lockfree_set_destroy(lockfree_set_t *set);
+
+/**
+ * @brief Adds an element to the set, unless an equal element is already in it.
+ *
+ * @param set The set to be added to.
+ * @param value The value to be added.
+ * @return True if the element was added, false if an equal element was already
+ *         in the set or memory allocation failed.
+ **/
+bool lockfree_set_insert(lockfree_set_t *set, const elem_t value);
+
+/**
+ * @brief Removes an element from the set.
+ *
+ * @param set The set to be modified.
+ * @param value The value to be removed.
+ * @param removed Set to the removed element if it is not NULL and an element was removed.
+ * @return True if an equal element was removed, false if there was none.
+ **/
+bool lockfree_set_remove(lockfree_set_t *set, const elem_t value, elem_t *removed);
+
+/**
+ * @brief Checks if the set contains an element.
+ *
+ * @param set The set.
+ * @param value The value sought.
+ * @return True if an equal element is in the set, false otherwise.
+ **/
+bool lockfree_set_contains(lockfree_set_t *set, const elem_t value);
+
+/**
+ * @brief Gets the number of elements in the set.
+ *
+ * The count may lag behind operations that are still in progress.
+ *
+ * @param set The set.
+ * @return The number of elements in the set.
+ **/
+size_t lockfree_set_size(lockfree_set_t *set);
+
+/**
+ * @brief Checks if the set is empty.
+ *
+ * @param set The set.
+ * @return True if the set is empty, false otherwise.
+ **/
+bool lockfree_set_is_empty(lockfree_set_t *set);
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdlib.h>
+
+/**
+ * @file pool.h
+ * @brief Slab allocator for fixed-size objects.
+ *
+ * This header file defines the interface for a pool allocator that hands out
+ * objects of a single fixed size. Objects are carved from large slabs, and
+ * released objects are kept on an intrusive free list for reuse, so that
+ * allocation and deallocation cost O(1) time without touching malloc for
+ * every object. Memory is only returned to the system when the pool is
+ * destroyed or reset.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ *
+ * @note A pool is not thread safe. A pool may be shared between several
+ *       data structures, but must outlive all of them.
+ **/
+
+/// @brief Pool allocator for fixed-size objects.
+typedef struct pool pool_t;
+
+/**
+ * @brief Creates a new empty pool.
+ *
+ * This function creates a pool that hands out objects of object_size bytes.
+ * Slabs holding objects_per_slab objects each are allocated on demand.
+ *
+ * @param object_size Size in bytes of every object handed out by the pool.
+ * @param objects_per_slab Number of objects per slab (0 selects a default).
+ * @return A pointer to an empty pool, or NULL if memory allocation failed.
+ **/
+pool_t *pool_create(const size_t object_size, const size_t objects_per_slab);
+
+/**
+ * @brief Destroys the pool and frees all its slabs.
+ *
+ * This function frees all memory held by the pool, including objects that
+ * are still in use.
+ *
+ * @param pool The pool to be destroyed.
+ **/
+void pool_destroy(pool_t *pool);
+
+/**
+ * @brief Releases all objects of the pool at once.
+ *
+ * This function frees all slabs of the pool, including objects that are still
+ * in use, and leaves the pool empty but usable. It takes time proportional to
+ * the number of slabs rather than the number of objects.
+ *
+ * @param pool The pool to be reset.
+ **/
+void pool_reset(pool_t *pool);
+
+/**
+ * @brief Allocates an object from the pool in O(1) time.
+ *
+ * This function returns a previously released object if there is one, and
+ * otherwise carves a new object from the current slab. The contents of the
+ * returned object are undefined.
+ *
+ * @param pool The pool to allocate from.
+ * @return A pointer to an object, or NULL if memory allocation failed.
+ **/
+void *pool_alloc(pool_t *pool);
+
+/**
+ * @brief Allocates a contiguous run of objects from the pool with a single allocation.
+ *
+ * This function allocates a dedicated slab holding exactly count objects. The
+ * objects are laid out pool_object_stride(pool) bytes apart, and each of them
+ * may later be released individually with pool_free.
+ *
+ * @param pool The pool to allocate from.
+ * @param count Number of objects to allocate (must be greater than 0).
+ * @return A pointer to the first object, or NULL if memory allocation failed or
+ *         count objects do not fit in a single allocation.
+ **/
+void *pool_alloc_many(pool_t *pool, const size_t count);
+
+/**
+ * @brief Returns an object to the pool in O(1) time.
+ *
+ * This function puts an object on the free list of the pool, from which it
+ * will be handed out again by a later call to pool_alloc.
+ *
+ * @param pool The pool the object was allocated from.
+ * @param object The object to be released (may be NULL).
+ **/
+void pool_free(pool_t *pool, void *object);
+
+/**
+ * @brief Gets the size of the objects handed out by the pool.
+ *
+ * @param pool The pool.
+ * @return The object size in bytes, as passed to pool_create.
+ **/
+size_t pool_object_size(pool_t *pool);
+
+/**
+ * @brief Gets the distance between two consecutive objects of a run from pool_alloc_many.
+ *
+ * @param pool The pool.
+ * @return The object size rounded up to the alignment of the pool.
+ **/
+size_t pool_object_stride(pool_t *pool);
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdlib.h>
+
+/**
+ * @file thread_pool.h
+ * @brief Pool of worker threads for running data-parallel tasks.
+ *
+ * This header file defines the interface for a fixed set of worker threads
+ * that run the chunks of one task at a time. A task is split into a number of
+ * chunks, which the workers and the calling thread claim one by one until none
+ * are left, so that faster threads take more chunks. The threads are created
+ * once and sleep between tasks, which makes a pool cheap to reuse for many
+ * parallel list operations.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ *
+ * @note Tasks may be run on the same pool from several threads, in which case
+ *       they run one after the other. A chunk must not run another task on the
+ *       pool that is running it.
+ **/
+
+/// @brief Pool of worker threads.
+typedef struct thread_pool thread_pool_t;
+
+/**
+ * @brief Function pointer type for one chunk of a task.
+ *
+ * @param arg The argument of the task.
+ * @param chunk The index of the chunk, in [0, chunks).
+ **/
+typedef void(*chunk_function)(void *arg, const size_t chunk);
+
+/**
+ * @brief Creates a new pool of worker threads.
+ *
+ * @param workers Number of worker threads besides the calling thread, or 0 to
+ *                start one less than the number of online processors.
+ * @return A pointer to the pool, or NULL if memory allocation or thread creation failed.
+ **/
+thread_pool_t *thread_pool_create(const size_t workers);
+
+/**
+ * @brief Destroys the pool, waiting for its worker threads to finish.
+ *
+ * @param pool The pool to be destroyed.
+ **/
+void thread_pool_destroy(thread_pool_t *pool);
+
+/**
+ * @brief Gets the number of threads that run the chunks of a task.
+ *
+ * @param pool The pool.
+ * @return The number of worker threads plus one for the calling thread.
+ **/
+size_t thread_pool_threads(thread_pool_t *pool);
+
+/**
+ * @brief Runs every chunk of a task exactly once and waits for all of them to finish.
+ *
+ * @param pool The pool.
+ * @param task The function run for every chunk.
+ * @param arg The argument passed to every chunk.
+ * @param chunks The number of chunks.
+ **/
+void thread_pool_run(thread_pool_t *pool, chunk_function task, void *arg, const size_t chunks);
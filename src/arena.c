@@ -0,0 +1,184 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "arena.h"
+
+/**
+ * @file arena.c
+ * @brief Implementation of the bump arena.
+ *
+ * This file contains the implementation of the arena functions defined in
+ * arena.h. The detailed descriptions of the functions are provided in the
+ * header file.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Size of a block when none is requested.
+#define ARENA_DEFAULT_BLOCK_SIZE 65536
+
+/// Header of a block, padded so that the objects following it are suitably aligned.
+typedef union block block_t;
+
+/// Header of a block, padded so that the objects following it are suitably aligned.
+union block
+{
+  struct
+  {
+    block_t *next;    // Previously allocated block.
+    size_t size;      // Number of bytes following the header.
+  } header;
+  max_align_t align;  // Alignment of the objects following the header.
+};
+
+/// Bump arena for objects that are all released together.
+struct arena
+{
+  size_t block_size;  // Size of the blocks objects are carved from.
+  block_t *blocks;    // Blocks in use, the current one first.
+  block_t *spare;     // Blocks kept by arena_reset for later use.
+  char *bump;         // Next free byte of the current block.
+  char *bump_end;     // End of the current block.
+};
+
+/**
+ * @brief Allocate a block, or take a spare one when it is large enough.
+ * @param arena The arena.
+ * @param size Number of bytes the block must hold.
+ * @return The block, or NULL if memory allocation failed.
+ **/
+static block_t *arena_inner_block(arena_t *arena, const size_t size);
+
+/**
+ * @brief Allocate a block, or take a spare one when it is large enough.
+ * @param arena The arena.
+ * @param size Number of bytes the block must hold.
+ * @return The block, or NULL if memory allocation failed.
+ **/
+static block_t *arena_inner_block(arena_t *arena, const size_t size)
+{
+  if (size == arena->block_size && arena->spare != NULL)
+    {
+      block_t *block = arena->spare;
+      arena->spare = block->header.next;
+      return block;
+    }
+  if (size > SIZE_MAX - sizeof(block_t))
+    {
+      puts("Too many bytes requested for one block.");
+      return NULL;
+    }
+  block_t *block = malloc(sizeof(block_t) + size);
+  if (block == NULL)
+    {
+      puts("Failed to allocate memory for another block.");
+      return NULL;
+    }
+  block->header.size = size;
+
+  return block;
+}
+
+arena_t *arena_create(const size_t block_size)
+{
+  // Rounding up and adding the block header must not wrap around.
+  if (block_size > SIZE_MAX - 2 * sizeof(block_t))
+    {
+      puts("Arena blocks cannot be that large.");
+      return NULL;
+    }
+  arena_t *arena = calloc(1, sizeof(arena_t));
+  if (arena == NULL)
+    {
+      puts("Failed to allocate memory for an arena.");
+      return NULL;
+    }
+  const size_t align = sizeof(block_t);
+  const size_t size = block_size > 0 ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+  arena->block_size = (size + align - 1) / align * align;
+
+  return arena;
+}
+
+void arena_destroy(arena_t *arena)
+{
+  arena_reset(arena);
+  while (arena->spare != NULL)
+    {
+      block_t *next = arena->spare->header.next;
+      free(arena->spare);
+      arena->spare = next;
+    }
+  free(arena);
+}
+
+void *arena_alloc(arena_t *arena, const size_t size)
+{
+  const size_t align = sizeof(block_t);
+  // Rounding up and adding the block header must not wrap around.
+  if (size > SIZE_MAX - 2 * align)
+    {
+      puts("Too many bytes requested from the arena.");
+      return NULL;
+    }
+  const size_t rounded = size > 0 ? (size + align - 1) / align * align : align;
+  if (arena->bump != NULL && rounded <= (size_t)(arena->bump_end - arena->bump))
+    {
+      void *result = arena->bump;
+      arena->bump += rounded;
+      return result;
+    }
+  if (rounded > arena->block_size / 4)
+    {
+      // A large object gets its own block, behind the current one so that bumping continues there.
+      block_t *block = arena_inner_block(arena, rounded);
+      if (block == NULL)
+        {
+          return NULL;
+        }
+      block->header.next = arena->blocks != NULL ? arena->blocks->header.next : NULL;
+      if (arena->blocks != NULL)
+        {
+          arena->blocks->header.next = block;
+        }
+      else
+        {
+          arena->blocks = block;
+        }
+      return block + 1;
+    }
+  block_t *block = arena_inner_block(arena, arena->block_size);
+  if (block == NULL)
+    {
+      return NULL;
+    }
+  block->header.next = arena->blocks;
+  arena->blocks = block;
+  arena->bump = (char *)(block + 1) + rounded;
+  arena->bump_end = (char *)(block + 1) + arena->block_size;
+
+  return block + 1;
+}
+
+void arena_reset(arena_t *arena)
+{
+  block_t *block = arena->blocks;
+  while (block != NULL)
+    {
+      block_t *next = block->header.next;
+      if (block->header.size == arena->block_size)
+        {
+          block->header.next = arena->spare;
+          arena->spare = block;
+        }
+      else
+        {
+          free(block);
+        }
+      block = next;
+    }
+  arena->blocks = NULL;
+  arena->bump = arena->bump_end = NULL;
+}
@@ -0,0 +1,580 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list_engine.h"
+
+/**
+ * @file array_list.c
+ * @brief Array storage engine for linked lists.
+ *
+ * This file implements a storage engine that keeps the elements of a list in
+ * one contiguous gap buffer: an array whose unused slots form a single gap.
+ * The elements before the gap are stored first, and the elements after it
+ * at the end of the array. Positional access takes O(1) time, scans read
+ * memory sequentially, and insertions and removals take time proportional to
+ * the distance from the previous one, since only the gap moves. Appending
+ * therefore takes amortised O(1) time, as does editing through an iterator.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Capacity of the array when the first element is added.
+#define ARRAY_INITIAL_CAPACITY 16
+/// Number of elements compared before a scan checks whether it found a match.
+#define ARRAY_SCAN_BLOCK 64
+
+/// Storage of an array list.
+typedef struct array_store
+{
+  elem_t *elements;  // Array of capacity slots.
+  size_t capacity;   // Number of slots.
+  size_t gap_start;  // First slot of the gap, which is also the number of elements before it.
+  size_t gap_end;    // First slot after the gap.
+} array_store_t;
+
+/**
+ * @brief Get the slot holding the element at an index.
+ * @param store The storage.
+ * @param index The index of an element.
+ * @return The slot of the element.
+ **/
+static size_t array_inner_slot(const array_store_t *store, const size_t index);
+
+/**
+ * @brief Move the gap so that it starts at an index.
+ * @param store The storage.
+ * @param index The number of elements to keep before the gap, at most the number of elements.
+ **/
+static void array_inner_move_gap(array_store_t *store, const size_t index);
+
+/**
+ * @brief Make room for one more element, doubling the array when the gap is empty.
+ * @param store The storage.
+ * @return True if the gap holds at least one slot, false if memory allocation failed.
+ **/
+static bool array_inner_reserve(array_store_t *store);
+
+/**
+ * @brief Insert an element at an index.
+ * @param list The list.
+ * @param index The index, in [0, n].
+ * @param value The element to insert.
+ * @return True if the element was inserted, false if memory allocation failed.
+ **/
+static bool array_inner_insert_at(list_t *list, const size_t index, const elem_t value);
+
+/**
+ * @brief Remove the element at an index.
+ * @param list The list.
+ * @param index The index, in [0, n-1].
+ * @return The removed element.
+ **/
+static elem_t array_inner_remove_at(list_t *list, const size_t index);
+
+/**
+ * @brief Move the gap to the end, so that all elements are stored first in order.
+ * @param list The list.
+ * @return The array, holding the elements in its first n slots.
+ **/
+static elem_t *array_inner_flatten(list_t *list);
+
+/**
+ * @brief Get the slot holding the element at an index.
+ * @param store The storage.
+ * @param index The index of an element.
+ * @return The slot of the element.
+ **/
+static size_t array_inner_slot(const array_store_t *store, const size_t index)
+{
+  return index < store->gap_start ? index : index + (store->gap_end - store->gap_start);
+}
+
+/**
+ * @brief Move the gap so that it starts at an index.
+ * @param store The storage.
+ * @param index The number of elements to keep before the gap, at most the number of elements.
+ **/
+static void array_inner_move_gap(array_store_t *store, const size_t index)
+{
+  if (index < store->gap_start)
+    {
+      const size_t count = store->gap_start - index;
+      memmove(store->elements + store->gap_end - count, store->elements + index, count * sizeof(elem_t));
+      store->gap_start -= count;
+      store->gap_end -= count;
+    }
+  else if (index > store->gap_start)
+    {
+      const size_t count = index - store->gap_start;
+      memmove(store->elements + store->gap_start, store->elements + store->gap_end, count * sizeof(elem_t));
+      store->gap_start += count;
+      store->gap_end += count;
+    }
+}
+
+/**
+ * @brief Make room for one more element, doubling the array when the gap is empty.
+ * @param store The storage.
+ * @return True if the gap holds at least one slot, false if memory allocation failed.
+ **/
+static bool array_inner_reserve(array_store_t *store)
+{
+  if (store->gap_start < store->gap_end)
+    {
+      return true;
+    }
+  const size_t capacity = store->capacity > 0 ? 2 * store->capacity : ARRAY_INITIAL_CAPACITY;
+  elem_t *elements = realloc(store->elements, capacity * sizeof(elem_t));
+  if (elements == NULL)
+    {
+      puts("Failed to allocate memory for a larger array.");
+      return false;
+    }
+  // The elements after the gap move to the end of the larger array.
+  const size_t after = store->capacity - store->gap_end;
+  memmove(elements + capacity - after, elements + store->gap_end, after * sizeof(elem_t));
+  store->elements = elements;
+  store->gap_end = capacity - after;
+  store->capacity = capacity;
+
+  return true;
+}
+
+/**
+ * @brief Insert an element at an index.
+ * @param list The list.
+ * @param index The index, in [0, n].
+ * @param value The element to insert.
+ * @return True if the element was inserted, false if memory allocation failed.
+ **/
+static bool array_inner_insert_at(list_t *list, const size_t index, const elem_t value)
+{
+  array_store_t *store = list->store;
+  if (!array_inner_reserve(store))
+    {
+      return false;
+    }
+  array_inner_move_gap(store, index);
+  store->elements[store->gap_start] = value;
+  store->gap_start += 1;
+  list->size += 1;
+
+  return true;
+}
+
+/**
+ * @brief Remove the element at an index.
+ * @param list The list.
+ * @param index The index, in [0, n-1].
+ * @return The removed element.
+ **/
+static elem_t array_inner_remove_at(list_t *list, const size_t index)
+{
+  array_store_t *store = list->store;
+  array_inner_move_gap(store, index);
+  const elem_t value_removed = store->elements[store->gap_end];
+  store->gap_end += 1;
+  list->size -= 1;
+
+  return value_removed;
+}
+
+/**
+ * @brief Move the gap to the end, so that all elements are stored first in order.
+ * @param list The list.
+ * @return The array, holding the elements in its first n slots.
+ **/
+static elem_t *array_inner_flatten(list_t *list)
+{
+  array_store_t *store = list->store;
+  array_inner_move_gap(store, list->size);
+
+  return store->elements;
+}
+
+static bool array_create(list_t *list)
+{
+  array_store_t *store = calloc(1, sizeof(array_store_t));
+  if (store == NULL)
+    {
+      puts("Failed to allocate memory for an array list.");
+      return false;
+    }
+  list->store = store;
+
+  return true;
+}
+
+static void array_clear(list_t *list)
+{
+  array_store_t *store = list->store;
+  for (size_t i = 0; i < list->size && list->destructor; ++i)
+    {
+      list->destructor(store->elements[array_inner_slot(store, i)]);
+    }
+  store->gap_start = 0;
+  store->gap_end = store->capacity;
+  list->size = 0;
+}
+
+static void array_destroy(list_t *list)
+{
+  array_store_t *store = list->store;
+  array_clear(list);
+  free(store->elements);
+  free(store);
+}
+
+static bool array_append(list_t *list, const elem_t value)
+{
+  if (!array_inner_insert_at(list, list->size, value))
+    {
+      puts("Append failed due to memory corruption!");
+      return false;
+    }
+  return true;
+}
+
+static bool array_prepend(list_t *list, const elem_t value)
+{
+  if (!array_inner_insert_at(list, 0, value))
+    {
+      puts("Prepend failed due to memory corruption!");
+      return false;
+    }
+  return true;
+}
+
+static bool array_insert(list_t *list, const size_t index, const elem_t value)
+{
+  if (!array_inner_insert_at(list, index, value))
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  return true;
+}
+
+static elem_t array_remove(list_t *list, const size_t index)
+{
+  return array_inner_remove_at(list, index);
+}
+
+static elem_t array_get(list_t *list, const size_t index)
+{
+  const array_store_t *store = list->store;
+  return store->elements[array_inner_slot(store, index)];
+}
+
+/// Scan the slots [begin, end) for an element, comparing a block at a time without branches so that the loop can be vectorised.
+#define ARRAY_SCAN_RANGE(elements, begin, end, element, member)              \
+  for (size_t block = (begin); block < (end); block += ARRAY_SCAN_BLOCK)      \
+    {                                                                         \
+      const size_t block_end = (end) - block < ARRAY_SCAN_BLOCK ? (end) : block + ARRAY_SCAN_BLOCK; \
+      bool found = false;                                                     \
+      for (size_t i = block; i < block_end; ++i)                              \
+        {                                                                     \
+          found |= (elements)[i].member == (element).member;                  \
+        }                                                                     \
+      if (found)                                                              \
+        {                                                                     \
+          return true;                                                        \
+        }                                                                     \
+    }
+
+/// Scan both sides of the gap for an element.
+#define ARRAY_SCAN(store, element, member)                                                         \
+  ARRAY_SCAN_RANGE((store)->elements, 0, (store)->gap_start, element, member)                      \
+  ARRAY_SCAN_RANGE((store)->elements, (store)->gap_end, (store)->capacity, element, member)        \
+  return false
+
+static bool array_contains(list_t *list, const elem_t element)
+{
+  const array_store_t *store = list->store;
+  switch (list->eq_kind)
+    {
+    case LIST_EQ_INT: ARRAY_SCAN(store, element, i);
+    case LIST_EQ_UNSIGNED: ARRAY_SCAN(store, element, u);
+    case LIST_EQ_BOOL: ARRAY_SCAN(store, element, b);
+    case LIST_EQ_FLOAT: ARRAY_SCAN(store, element, f);
+    case LIST_EQ_POINTER: ARRAY_SCAN(store, element, p);
+    case LIST_EQ_CUSTOM: break;
+    }
+  const size_t bounds[] = { 0, store->gap_start, store->gap_end, store->capacity };
+  for (size_t side = 0; side < 4; side += 2)
+    {
+      for (size_t i = bounds[side]; i < bounds[side + 1]; ++i)
+        {
+          if (list->fun(store->elements[i], element))
+            {
+              return true;
+            }
+        }
+    }
+  return false;
+}
+
+static bool array_all(list_t *list, predicate prop, const void *extra)
+{
+  const array_store_t *store = list->store;
+  const size_t bounds[] = { 0, store->gap_start, store->gap_end, store->capacity };
+  size_t calls = 0;
+  size_t segments = 0;
+  for (size_t side = 0; side < 4; side += 2)
+    {
+      segments += bounds[side] < bounds[side + 1];
+      for (size_t i = bounds[side]; i < bounds[side + 1]; ++i)
+        {
+          ++calls;
+          if (!prop(store->elements[i], extra))
+            {
+              LIST_COUNT(list, calls, segments);
+              return false;
+            }
+        }
+    }
+  LIST_COUNT(list, calls, segments);
+  return true;
+}
+
+static bool array_any(list_t *list, predicate prop, const void *extra)
+{
+  const array_store_t *store = list->store;
+  const size_t bounds[] = { 0, store->gap_start, store->gap_end, store->capacity };
+  size_t calls = 0;
+  size_t segments = 0;
+  for (size_t side = 0; side < 4; side += 2)
+    {
+      segments += bounds[side] < bounds[side + 1];
+      for (size_t i = bounds[side]; i < bounds[side + 1]; ++i)
+        {
+          ++calls;
+          if (prop(store->elements[i], extra))
+            {
+              LIST_COUNT(list, calls, segments);
+              return true;
+            }
+        }
+    }
+  LIST_COUNT(list, calls, segments);
+  return false;
+}
+
+static void array_apply_to_all(list_t *list, apply_function fun, const void *extra)
+{
+  array_store_t *store = list->store;
+  for (size_t i = 0; i < store->gap_start; ++i)
+    {
+      fun(&store->elements[i], extra);
+    }
+  for (size_t i = store->gap_end; i < store->capacity; ++i)
+    {
+      fun(&store->elements[i], extra);
+    }
+}
+
+static size_t array_split(list_t *list, list_chunk_t *chunks, const size_t count)
+{
+  size_t start = 0;
+  for (size_t i = 0; i < count; ++i)
+    {
+      const size_t end = (i + 1) * list->size / count;
+      chunks[i] = (list_chunk_t) { .node = list->store, .offset = start, .length = end - start };
+      start = end;
+    }
+  return count;
+}
+
+static elem_t *array_chunk_next(list_chunk_t *chunk)
+{
+  if (chunk->length == 0)
+    {
+      return NULL;
+    }
+  array_store_t *store = chunk->node;
+  const size_t slot = array_inner_slot(store, chunk->offset);
+  if (chunk->nodes == 0 || chunk->offset == store->gap_start)
+    {
+      chunk->nodes += 1;
+    }
+  chunk->offset += 1;
+  chunk->length -= 1;
+  return &store->elements[slot];
+}
+
+static bool array_sort(list_t *list, cmp_function cmp)
+{
+  const size_t size = list->size;
+  if (size < 2)
+    {
+      return true;
+    }
+  elem_t *buffer = malloc(size * sizeof(elem_t));
+  if (buffer == NULL)
+    {
+      return false;
+    }
+  elem_t *elements = array_inner_flatten(list);
+
+  // Merge runs of width elements pairwise into the other array, doubling the width on every pass.
+  elem_t *from = elements;
+  elem_t *to = buffer;
+  for (size_t width = 1; width < size; width *= 2)
+    {
+      for (size_t low = 0; low < size; low += 2 * width)
+        {
+          const size_t middle = low + width < size ? low + width : size;
+          const size_t high = middle + width < size ? middle + width : size;
+          size_t left = low;
+          size_t right = middle;
+          for (size_t out = low; out < high; ++out)
+            {
+              const bool take_right = right < high && (left == middle || cmp(from[right], from[left]) < 0);
+              to[out] = take_right ? from[right++] : from[left++];
+            }
+        }
+      elem_t *swap = from;
+      from = to;
+      to = swap;
+    }
+  if (from != elements)
+    {
+      memcpy(elements, from, size * sizeof(elem_t));
+    }
+  free(buffer);
+  return true;
+}
+
+static size_t array_filter(list_t *list, predicate prop, const void *extra, const bool matching)
+{
+  array_store_t *store = list->store;
+  elem_t *elements = array_inner_flatten(list);
+  size_t kept = 0;
+  for (size_t i = 0; i < list->size; ++i)
+    {
+      const elem_t value = elements[i];
+      if (prop(value, extra) != matching)
+        {
+          elements[kept++] = value;
+        }
+      else if (list->destructor != NULL)
+        {
+          list->destructor(value);
+        }
+    }
+  const size_t removed = list->size - kept;
+  store->gap_start = kept;
+  list->size = kept;
+
+  return removed;
+}
+
+static void array_iterator_reset(list_iterator_t *iter)
+{
+  iter->node = iter->list->store;
+  iter->offset = 0;
+}
+
+static bool array_iterator_has_next(list_iterator_t *iter)
+{
+  return iter->offset < iter->list->size;
+}
+
+static elem_t array_iterator_next(list_iterator_t *iter)
+{
+  const elem_t value = array_get(iter->list, iter->offset);
+  iter->offset += 1;
+
+  return value;
+}
+
+static elem_t array_iterator_remove(list_iterator_t *iter)
+{
+  if (!array_iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  return array_inner_remove_at(iter->list, iter->offset);
+}
+
+static bool array_iterator_insert(list_iterator_t *iter, const elem_t element)
+{
+  if (!array_inner_insert_at(iter->list, iter->offset, element))
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  return true;
+}
+
+static elem_t array_iterator_current(list_iterator_t *iter)
+{
+  if (!array_iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  return array_get(iter->list, iter->offset);
+}
+
+static bool array_iterator_has_previous(list_iterator_t *iter)
+{
+  return iter->offset > 0;
+}
+
+static elem_t array_iterator_previous(list_iterator_t *iter)
+{
+  if (!array_iterator_has_previous(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  iter->offset -= 1;
+
+  return array_get(iter->list, iter->offset);
+}
+
+static void array_iterator_to_end(list_iterator_t *iter)
+{
+  iter->offset = iter->list->size;
+}
+
+void array_segments(list_t *list, const elem_t **segments, size_t *counts)
+{
+  const array_store_t *store = list->store;
+  segments[0] = store->elements;
+  counts[0] = store->gap_start;
+  segments[1] = store->capacity > 0 ? store->elements + store->gap_end : store->elements;
+  counts[1] = store->capacity - store->gap_end;
+}
+
+const list_engine_t array_engine =
+  {
+    .create = array_create,
+    .destroy = array_destroy,
+    .append = array_append,
+    .prepend = array_prepend,
+    .insert = array_insert,
+    .remove = array_remove,
+    .get = array_get,
+    .contains = array_contains,
+    .clear = array_clear,
+    .all = array_all,
+    .any = array_any,
+    .apply_to_all = array_apply_to_all,
+    .iterator_reset = array_iterator_reset,
+    .iterator_has_next = array_iterator_has_next,
+    .iterator_next = array_iterator_next,
+    .iterator_remove = array_iterator_remove,
+    .iterator_insert = array_iterator_insert,
+    .iterator_current = array_iterator_current,
+    .iterator_has_previous = array_iterator_has_previous,
+    .iterator_previous = array_iterator_previous,
+    .iterator_to_end = array_iterator_to_end,
+    .split = array_split,
+    .chunk_next = array_chunk_next,
+    .sort = array_sort,
+    .filter = array_filter,
+  };
@@ -0,0 +1,701 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "list_engine.h"
+
+/**
+ * @file compact_list.c
+ * @brief Compact storage engine for linked lists.
+ *
+ * This file implements a storage engine that keeps a singly linked chain in
+ * two growable arrays indexed by slot: one holding the element of every slot
+ * and one holding the slot of the next element as a 32-bit index. A link thus
+ * takes 12 bytes instead of a malloc block holding an element and a pointer,
+ * and links made one after another sit next to each other in memory. Slot 0
+ * is the sentinel, so a next index of 0 marks the end of the chain. Released
+ * slots are chained through their next index and reused first. Slots never
+ * move, so iterators refer to them directly and survive growth of the arrays.
+ *
+ * The arrays may also live in a private mapping of a file written by
+ * linked_list_save, in which case pages are read when first touched and
+ * copied when first written. The arrays move to the heap when they grow.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Number of slots when the list is created, including the sentinel.
+#define COMPACT_INITIAL_CAPACITY 16
+
+/// Storage of a compact list.
+typedef struct compact_store
+{
+  elem_t *values;     // Element of every slot.
+  uint32_t *next;     // Slot of the next element for every slot, or 0 after the last element.
+  uint32_t capacity;  // Number of slots in both arrays.
+  uint32_t used;      // Number of slots handed out at least once, starting with the sentinel.
+  uint32_t free;      // First released slot, chained through next, or 0 if there is none.
+  uint32_t last;      // Slot of the last element, or 0 if the list is empty.
+  uint32_t cursor;    // Slot last reached by a positional access, starting at the sentinel.
+  size_t cursor_position; // Position of the cursor, where the sentinel is at position 0.
+  void *mapping;      // Private file mapping holding both arrays, or NULL if they are on the heap.
+  size_t mapping_length; // Length of the mapping in bytes.
+} compact_store_t;
+
+/**
+ * @brief Take a slot for a new element, growing the arrays if all slots are in use.
+ * @param store The storage.
+ * @param value The element to store in the slot.
+ * @return The slot, or 0 if memory allocation failed or the list holds the most elements 32-bit indices allow.
+ **/
+static uint32_t compact_inner_slot_new(compact_store_t *store, const elem_t value);
+
+/**
+ * @brief Grow both arrays by half, moving them to the heap if they live in a file mapping.
+ * @param store The storage.
+ * @return True on success, false if memory allocation failed or the arrays hold the most slots 32-bit indices allow.
+ **/
+static bool compact_inner_grow(compact_store_t *store);
+
+/**
+ * @brief Release a slot for reuse.
+ * @param store The storage.
+ * @param slot The slot, which must no longer be part of the chain.
+ **/
+static void compact_inner_slot_free(compact_store_t *store, const uint32_t slot);
+
+/**
+ * @brief Find the slot preceding the element at an index, resuming from the cursor when it is not past it.
+ * @param store The storage.
+ * @param index The index, in [0, n].
+ * @return The slot at position index, which is the sentinel for index 0.
+ **/
+static uint32_t compact_inner_before(compact_store_t *store, const size_t index);
+
+/**
+ * @brief Link a new element after a slot.
+ * @param list The list.
+ * @param before The slot to link the element after.
+ * @param value The element to insert.
+ * @return The slot of the element, or 0 if memory allocation failed.
+ **/
+static uint32_t compact_inner_link_after(list_t *list, const uint32_t before, const elem_t value);
+
+/**
+ * @brief Unlink the element after a slot and release its slot.
+ * @param list The list.
+ * @param before The slot preceding the element, which must not be the last slot.
+ * @return The removed element.
+ **/
+static elem_t compact_inner_unlink_after(list_t *list, const uint32_t before);
+
+/**
+ * @brief Move the cursor back to the sentinel.
+ * @param store The storage.
+ **/
+static void compact_inner_cursor_reset(compact_store_t *store);
+
+/**
+ * @brief Take a slot for a new element, growing the arrays if all slots are in use.
+ * @param store The storage.
+ * @param value The element to store in the slot.
+ * @return The slot, or 0 if memory allocation failed or the list holds the most elements 32-bit indices allow.
+ **/
+static uint32_t compact_inner_slot_new(compact_store_t *store, const elem_t value)
+{
+  uint32_t slot = store->free;
+  if (slot != 0)
+    {
+      store->free = store->next[slot];
+    }
+  else if (store->used < store->capacity || compact_inner_grow(store))
+    {
+      slot = store->used;
+      store->used += 1;
+    }
+  else
+    {
+      return 0;
+    }
+  store->values[slot] = value;
+  store->next[slot] = 0;
+
+  return slot;
+}
+
+/**
+ * @brief Grow both arrays by half, moving them to the heap if they live in a file mapping.
+ * @param store The storage.
+ * @return True on success, false if memory allocation failed or the arrays hold the most slots 32-bit indices allow.
+ **/
+static bool compact_inner_grow(compact_store_t *store)
+{
+  if (store->capacity == UINT32_MAX)
+    {
+      puts("Compact lists cannot hold more elements than 32-bit indices allow.");
+      return false;
+    }
+  const uint32_t growth = store->capacity < COMPACT_INITIAL_CAPACITY ? COMPACT_INITIAL_CAPACITY : store->capacity / 2;
+  const uint32_t capacity = UINT32_MAX - store->capacity < growth ? UINT32_MAX : store->capacity + growth;
+  if (store->mapping != NULL)
+    {
+      // The mapping cannot grow, so the slots move to the heap.
+      elem_t *values = malloc(capacity * sizeof(elem_t));
+      uint32_t *next = malloc(capacity * sizeof(uint32_t));
+      if (values == NULL || next == NULL)
+        {
+          puts("Failed to allocate memory for more slots.");
+          free(values);
+          free(next);
+          return false;
+        }
+      memcpy(values, store->values, store->used * sizeof(elem_t));
+      memcpy(next, store->next, store->used * sizeof(uint32_t));
+      munmap(store->mapping, store->mapping_length);
+      store->mapping = NULL;
+      store->values = values;
+      store->next = next;
+      store->capacity = capacity;
+      return true;
+    }
+  elem_t *values = realloc(store->values, capacity * sizeof(elem_t));
+  if (values == NULL)
+    {
+      puts("Failed to allocate memory for more slots.");
+      return false;
+    }
+  store->values = values;
+  uint32_t *next = realloc(store->next, capacity * sizeof(uint32_t));
+  if (next == NULL)
+    {
+      puts("Failed to allocate memory for more slots.");
+      return false;
+    }
+  store->next = next;
+  store->capacity = capacity;
+
+  return true;
+}
+
+/**
+ * @brief Release a slot for reuse.
+ * @param store The storage.
+ * @param slot The slot, which must no longer be part of the chain.
+ **/
+static void compact_inner_slot_free(compact_store_t *store, const uint32_t slot)
+{
+  store->next[slot] = store->free;
+  store->free = slot;
+}
+
+/**
+ * @brief Find the slot preceding the element at an index, resuming from the cursor when it is not past it.
+ * @param store The storage.
+ * @param index The index, in [0, n].
+ * @return The slot at position index, which is the sentinel for index 0.
+ **/
+static uint32_t compact_inner_before(compact_store_t *store, const size_t index)
+{
+  uint32_t slot = 0;
+  size_t position = 0;
+  if (store->cursor_position <= index)
+    {
+      slot = store->cursor;
+      position = store->cursor_position;
+    }
+  for (; position < index; ++position)
+    {
+      slot = store->next[slot];
+    }
+  store->cursor = slot;
+  store->cursor_position = index;
+
+  return slot;
+}
+
+/**
+ * @brief Link a new element after a slot.
+ * @param list The list.
+ * @param before The slot to link the element after.
+ * @param value The element to insert.
+ * @return The slot of the element, or 0 if memory allocation failed.
+ **/
+static uint32_t compact_inner_link_after(list_t *list, const uint32_t before, const elem_t value)
+{
+  compact_store_t *store = list->store;
+  const uint32_t slot = compact_inner_slot_new(store, value);
+  if (slot == 0)
+    {
+      return 0;
+    }
+  store->next[slot] = store->next[before];
+  store->next[before] = slot;
+  if (store->last == before)
+    {
+      store->last = slot;
+    }
+  list->size += 1;
+
+  return slot;
+}
+
+/**
+ * @brief Unlink the element after a slot and release its slot.
+ * @param list The list.
+ * @param before The slot preceding the element, which must not be the last slot.
+ * @return The removed element.
+ **/
+static elem_t compact_inner_unlink_after(list_t *list, const uint32_t before)
+{
+  compact_store_t *store = list->store;
+  const uint32_t slot = store->next[before];
+  const elem_t value_removed = store->values[slot];
+  store->next[before] = store->next[slot];
+  if (store->last == slot)
+    {
+      store->last = before;
+    }
+  compact_inner_slot_free(store, slot);
+  list->size -= 1;
+
+  return value_removed;
+}
+
+/**
+ * @brief Move the cursor back to the sentinel.
+ * @param store The storage.
+ **/
+static void compact_inner_cursor_reset(compact_store_t *store)
+{
+  store->cursor = 0;
+  store->cursor_position = 0;
+}
+
+static bool compact_create(list_t *list)
+{
+  compact_store_t *store = calloc(1, sizeof(compact_store_t));
+  elem_t *values = malloc(COMPACT_INITIAL_CAPACITY * sizeof(elem_t));
+  uint32_t *next = malloc(COMPACT_INITIAL_CAPACITY * sizeof(uint32_t));
+  if (store == NULL || values == NULL || next == NULL)
+    {
+      puts("Failed to allocate memory for a compact list.");
+      free(store);
+      free(values);
+      free(next);
+      return false;
+    }
+  store->values = values;
+  store->next = next;
+  store->capacity = COMPACT_INITIAL_CAPACITY;
+  store->used = 1;
+  store->next[0] = 0;
+  list->store = store;
+
+  return true;
+}
+
+static void compact_clear(list_t *list)
+{
+  compact_store_t *store = list->store;
+  for (uint32_t slot = store->next[0]; slot != 0 && list->destructor; slot = store->next[slot])
+    {
+      list->destructor(store->values[slot]);
+    }
+  store->used = 1;
+  store->free = 0;
+  store->last = 0;
+  store->next[0] = 0;
+  compact_inner_cursor_reset(store);
+  list->size = 0;
+}
+
+static void compact_destroy(list_t *list)
+{
+  compact_store_t *store = list->store;
+  compact_clear(list);
+  if (store->mapping != NULL)
+    {
+      munmap(store->mapping, store->mapping_length);
+    }
+  else
+    {
+      free(store->values);
+      free(store->next);
+    }
+  free(store);
+}
+
+static bool compact_append(list_t *list, const elem_t value)
+{
+  compact_store_t *store = list->store;
+  if (compact_inner_link_after(list, store->last, value) == 0)
+    {
+      puts("Append failed due to memory corruption!");
+      return false;
+    }
+  return true;
+}
+
+static bool compact_prepend(list_t *list, const elem_t value)
+{
+  compact_store_t *store = list->store;
+  if (compact_inner_link_after(list, 0, value) == 0)
+    {
+      puts("Prepend failed due to memory corruption!");
+      return false;
+    }
+  if (store->cursor_position > 0)
+    {
+      store->cursor_position += 1;
+    }
+  return true;
+}
+
+static bool compact_insert(list_t *list, const size_t index, const elem_t value)
+{
+  compact_store_t *store = list->store;
+  const uint32_t before = index == list->size ? store->last : compact_inner_before(store, index);
+  if (compact_inner_link_after(list, before, value) == 0)
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  return true;
+}
+
+static elem_t compact_remove(list_t *list, const size_t index)
+{
+  compact_store_t *store = list->store;
+  return compact_inner_unlink_after(list, compact_inner_before(store, index));
+}
+
+static elem_t compact_get(list_t *list, const size_t index)
+{
+  compact_store_t *store = list->store;
+  if (index + 1 == list->size)
+    {
+      return store->values[store->last];
+    }
+  return store->values[store->next[compact_inner_before(store, index)]];
+}
+
+/// Walk the chain of a compact list for an element by comparing one member directly.
+#define COMPACT_SCAN(store, element, member)                                          \
+  for (uint32_t slot = (store)->next[0]; slot != 0; slot = (store)->next[slot])      \
+    {                                                                                 \
+      if ((store)->values[slot].member == (element).member)                           \
+        {                                                                             \
+          return true;                                                                \
+        }                                                                             \
+    }                                                                                 \
+  return false
+
+static bool compact_contains(list_t *list, const elem_t element)
+{
+  const compact_store_t *store = list->store;
+  switch (list->eq_kind)
+    {
+    case LIST_EQ_INT: COMPACT_SCAN(store, element, i);
+    case LIST_EQ_UNSIGNED: COMPACT_SCAN(store, element, u);
+    case LIST_EQ_BOOL: COMPACT_SCAN(store, element, b);
+    case LIST_EQ_FLOAT: COMPACT_SCAN(store, element, f);
+    case LIST_EQ_POINTER: COMPACT_SCAN(store, element, p);
+    case LIST_EQ_CUSTOM: break;
+    }
+  for (uint32_t slot = store->next[0]; slot != 0; slot = store->next[slot])
+    {
+      if (list->fun(store->values[slot], element))
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+static bool compact_all(list_t *list, predicate prop, const void *extra)
+{
+  const compact_store_t *store = list->store;
+  size_t calls = 0;
+  for (uint32_t slot = store->next[0]; slot != 0; slot = store->next[slot])
+    {
+      ++calls;
+      if (!prop(store->values[slot], extra))
+        {
+          LIST_COUNT(list, calls, calls);
+          return false;
+        }
+    }
+  LIST_COUNT(list, calls, calls);
+  return true;
+}
+
+static bool compact_any(list_t *list, predicate prop, const void *extra)
+{
+  const compact_store_t *store = list->store;
+  size_t calls = 0;
+  for (uint32_t slot = store->next[0]; slot != 0; slot = store->next[slot])
+    {
+      ++calls;
+      if (prop(store->values[slot], extra))
+        {
+          LIST_COUNT(list, calls, calls);
+          return true;
+        }
+    }
+  LIST_COUNT(list, calls, calls);
+  return false;
+}
+
+static void compact_apply_to_all(list_t *list, apply_function fun, const void *extra)
+{
+  compact_store_t *store = list->store;
+  for (uint32_t slot = store->next[0]; slot != 0; slot = store->next[slot])
+    {
+      fun(&store->values[slot], extra);
+    }
+}
+
+static size_t compact_split(list_t *list, list_chunk_t *chunks, const size_t count)
+{
+  compact_store_t *store = list->store;
+  uint32_t slot = store->next[0];
+  size_t start = 0;
+  for (size_t i = 0; i < count; ++i)
+    {
+      const size_t end = (i + 1) * list->size / count;
+      chunks[i] = (list_chunk_t) { .node = store, .offset = slot, .length = end - start };
+      for (size_t position = start; position < end; ++position)
+        {
+          slot = store->next[slot];
+        }
+      start = end;
+    }
+  return count;
+}
+
+static elem_t *compact_chunk_next(list_chunk_t *chunk)
+{
+  if (chunk->length == 0)
+    {
+      return NULL;
+    }
+  compact_store_t *store = chunk->node;
+  const uint32_t slot = (uint32_t)chunk->offset;
+  chunk->offset = store->next[slot];
+  chunk->length -= 1;
+  chunk->nodes += 1;
+  return &store->values[slot];
+}
+
+static bool compact_sort(list_t *list, cmp_function cmp)
+{
+  compact_store_t *store = list->store;
+  const size_t size = list->size;
+  if (size < 2)
+    {
+      return true;
+    }
+  elem_t *buffer = malloc(2 * size * sizeof(elem_t));
+  if (buffer == NULL)
+    {
+      return false;
+    }
+  size_t position = 0;
+  for (uint32_t slot = store->next[0]; slot != 0; slot = store->next[slot])
+    {
+      buffer[position++] = store->values[slot];
+    }
+
+  // Merge runs of width elements pairwise into the other half, doubling the width on every pass.
+  elem_t *from = buffer;
+  elem_t *to = buffer + size;
+  for (size_t width = 1; width < size; width *= 2)
+    {
+      for (size_t low = 0; low < size; low += 2 * width)
+        {
+          const size_t middle = low + width < size ? low + width : size;
+          const size_t high = middle + width < size ? middle + width : size;
+          size_t left = low;
+          size_t right = middle;
+          for (size_t out = low; out < high; ++out)
+            {
+              const bool take_right = right < high && (left == middle || cmp(from[right], from[left]) < 0);
+              to[out] = take_right ? from[right++] : from[left++];
+            }
+        }
+      elem_t *swap = from;
+      from = to;
+      to = swap;
+    }
+
+  // Lay the sorted chain out in consecutive slots, which also drops all released slots.
+  memcpy(store->values + 1, from, size * sizeof(elem_t));
+  for (uint32_t slot = 0; slot < size; ++slot)
+    {
+      store->next[slot] = slot + 1;
+    }
+  store->next[size] = 0;
+  store->used = (uint32_t)size + 1;
+  store->free = 0;
+  store->last = (uint32_t)size;
+  compact_inner_cursor_reset(store);
+  free(buffer);
+  return true;
+}
+
+static size_t compact_filter(list_t *list, predicate prop, const void *extra, const bool matching)
+{
+  compact_store_t *store = list->store;
+  const size_t size = list->size;
+  uint32_t before = 0;
+  while (store->next[before] != 0)
+    {
+      const elem_t value = store->values[store->next[before]];
+      if (prop(value, extra) != matching)
+        {
+          before = store->next[before];
+          continue;
+        }
+      compact_inner_unlink_after(list, before);
+      if (list->destructor != NULL)
+        {
+          list->destructor(value);
+        }
+    }
+  compact_inner_cursor_reset(store);
+
+  return size - list->size;
+}
+
+static void compact_iterator_reset(list_iterator_t *iter)
+{
+  iter->node = iter->list->store;
+  iter->offset = 0;
+}
+
+static bool compact_iterator_has_next(list_iterator_t *iter)
+{
+  const compact_store_t *store = iter->list->store;
+  return store->next[iter->offset] != 0;
+}
+
+static elem_t compact_iterator_next(list_iterator_t *iter)
+{
+  const compact_store_t *store = iter->list->store;
+  iter->offset = store->next[iter->offset];
+
+  return store->values[iter->offset];
+}
+
+static elem_t compact_iterator_remove(list_iterator_t *iter)
+{
+  if (!compact_iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  compact_inner_cursor_reset(iter->list->store);
+  return compact_inner_unlink_after(iter->list, (uint32_t)iter->offset);
+}
+
+static bool compact_iterator_insert(list_iterator_t *iter, const elem_t element)
+{
+  if (compact_inner_link_after(iter->list, (uint32_t)iter->offset, element) == 0)
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  compact_inner_cursor_reset(iter->list->store);
+  return true;
+}
+
+static elem_t compact_iterator_current(list_iterator_t *iter)
+{
+  if (!compact_iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  const compact_store_t *store = iter->list->store;
+  return store->values[store->next[iter->offset]];
+}
+
+static bool compact_iterator_has_previous(list_iterator_t *iter)
+{
+  return iter->offset != 0;
+}
+
+static elem_t compact_iterator_previous(list_iterator_t *iter)
+{
+  if (!compact_iterator_has_previous(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  const compact_store_t *store = iter->list->store;
+  const elem_t value = store->values[iter->offset];
+  // Slots only point forward, so the preceding slot is found by walking from the sentinel.
+  uint32_t slot = 0;
+  while (store->next[slot] != iter->offset)
+    {
+      slot = store->next[slot];
+    }
+  iter->offset = slot;
+
+  return value;
+}
+
+static void compact_iterator_to_end(list_iterator_t *iter)
+{
+  const compact_store_t *store = iter->list->store;
+  iter->offset = store->last;
+}
+
+void compact_map(list_t *list, void *mapping, const size_t length, elem_t *values, uint32_t *next,
+                 const uint32_t slots, const uint32_t last, const size_t size)
+{
+  compact_store_t *store = list->store;
+  free(store->values);
+  free(store->next);
+  *store = (compact_store_t) {
+    .values = values,
+    .next = next,
+    .capacity = slots,
+    .used = slots,
+    .last = last,
+    .mapping = mapping,
+    .mapping_length = length,
+  };
+  list->size = size;
+}
+
+const list_engine_t compact_engine =
+  {
+    .create = compact_create,
+    .destroy = compact_destroy,
+    .append = compact_append,
+    .prepend = compact_prepend,
+    .insert = compact_insert,
+    .remove = compact_remove,
+    .get = compact_get,
+    .contains = compact_contains,
+    .clear = compact_clear,
+    .all = compact_all,
+    .any = compact_any,
+    .apply_to_all = compact_apply_to_all,
+    .iterator_reset = compact_iterator_reset,
+    .iterator_has_next = compact_iterator_has_next,
+    .iterator_next = compact_iterator_next,
+    .iterator_remove = compact_iterator_remove,
+    .iterator_insert = compact_iterator_insert,
+    .iterator_current = compact_iterator_current,
+    .iterator_has_previous = compact_iterator_has_previous,
+    .iterator_previous = compact_iterator_previous,
+    .iterator_to_end = compact_iterator_to_end,
+    .split = compact_split,
+    .chunk_next = compact_chunk_next,
+    .sort = compact_sort,
+    .filter = compact_filter,
+  };
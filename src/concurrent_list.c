@@ -0,0 +1,424 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include "concurrent_list.h"
+
+/**
+ * @file concurrent_list.c
+ * @brief Implementation of the thread-safe linked list.
+ *
+ * Links are locked in list order, from the sentinel towards the end. The tail
+ * lock is taken before any link lock by concurrent_list_append and
+ * concurrent_list_clear. Operations that hold link locks and need to change
+ * the last link only try to take the tail lock, and start over if it is busy,
+ * which keeps the lock order acyclic.
+ *
+ * A link is only unlinked while both it and its predecessor are locked. Every
+ * thread reaches a link through the lock of its predecessor, so nobody else
+ * can hold or wait for the link, and it can be freed right away.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Link of a concurrent list.
+typedef struct clink clink_t;
+
+/// Link of a concurrent list.
+struct clink
+{
+  elem_t value;          // Element value.
+  clink_t *next;         // Next element, guarded by lock.
+  pthread_mutex_t lock;  // Lock of the link.
+};
+
+/// Thread-safe linked list structure for holding generic elements.
+struct concurrent_list
+{
+  clink_t *first;             // Sentinel link, which is never removed.
+  clink_t *last;              // Last link, guarded by tail_lock.
+  pthread_mutex_t tail_lock;  // Lock of the last link pointer.
+  atomic_size_t size;         // Number of elements stored in the list.
+  eq_function fun;            // Function pointer for element equality comparison.
+};
+
+/**
+ * @brief Create a new unlocked link.
+ * @param value Element value to set.
+ * @return A pointer to the newly created link, or NULL if memory allocation failed.
+ **/
+static clink_t *clink_new(const elem_t value);
+
+/**
+ * @brief Free a link that no other thread can reach.
+ * @param link The link to free.
+ **/
+static void clink_free(clink_t *link);
+
+/**
+ * @brief Walk to the link at a position with hand-over-hand locking.
+ * @param list The list.
+ * @param position The position, where the sentinel is at position 0.
+ * @return The locked link at the position, or NULL if the list is shorter.
+ **/
+static clink_t *clist_inner_lock_at(concurrent_list_t *list, const size_t position);
+
+/**
+ * @brief Link a new link after a locked link.
+ * @param list The list.
+ * @param before The locked link to insert after.
+ * @param link The new link.
+ * @return True on success, false if before is the last link and the tail lock was busy.
+ **/
+static bool clist_inner_link_after(concurrent_list_t *list, clink_t *before, clink_t *link);
+
+/**
+ * @brief Create a new unlocked link.
+ * @param value Element value to set.
+ * @return A pointer to the newly created link, or NULL if memory allocation failed.
+ **/
+static clink_t *clink_new(const elem_t value)
+{
+  clink_t *link = calloc(1, sizeof(clink_t));
+  if (link == NULL)
+    {
+      puts("Failed to allocate memory for another link.");
+      return NULL;
+    }
+  link->value = value;
+  link->next = NULL;
+  pthread_mutex_init(&link->lock, NULL);
+
+  return link;
+}
+
+/**
+ * @brief Free a link that no other thread can reach.
+ * @param link The link to free.
+ **/
+static void clink_free(clink_t *link)
+{
+  pthread_mutex_destroy(&link->lock);
+  free(link);
+}
+
+/**
+ * @brief Walk to the link at a position with hand-over-hand locking.
+ * @param list The list.
+ * @param position The position, where the sentinel is at position 0.
+ * @return The locked link at the position, or NULL if the list is shorter.
+ **/
+static clink_t *clist_inner_lock_at(concurrent_list_t *list, const size_t position)
+{
+  clink_t *link = list->first;
+  pthread_mutex_lock(&link->lock);
+  for (size_t i = 0; i < position; ++i)
+    {
+      clink_t *next = link->next;
+      if (next == NULL)
+        {
+          pthread_mutex_unlock(&link->lock);
+          return NULL;
+        }
+      pthread_mutex_lock(&next->lock);
+      pthread_mutex_unlock(&link->lock);
+      link = next;
+    }
+
+  return link;
+}
+
+/**
+ * @brief Link a new link after a locked link.
+ * @param list The list.
+ * @param before The locked link to insert after.
+ * @param link The new link.
+ * @return True on success, false if before is the last link and the tail lock was busy.
+ **/
+static bool clist_inner_link_after(concurrent_list_t *list, clink_t *before, clink_t *link)
+{
+  if (before->next == NULL)
+    {
+      if (pthread_mutex_trylock(&list->tail_lock) != 0)
+        {
+          return false;
+        }
+      before->next = link;
+      list->last = link;
+      pthread_mutex_unlock(&list->tail_lock);
+    }
+  else
+    {
+      link->next = before->next;
+      before->next = link;
+    }
+  atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+
+  return true;
+}
+
+concurrent_list_t *concurrent_list_create(eq_function fun)
+{
+  concurrent_list_t *list = calloc(1, sizeof(concurrent_list_t));
+  if (list == NULL)
+    {
+      puts("Failed to allocate memory for a concurrent list.");
+      return NULL;
+    }
+  list->first = list->last = clink_new((elem_t) { .i = 0 });
+  if (list->first == NULL)
+    {
+      free(list);
+      return NULL;
+    }
+  pthread_mutex_init(&list->tail_lock, NULL);
+  atomic_init(&list->size, 0);
+  list->fun = fun;
+
+  return list;
+}
+
+void concurrent_list_destroy(concurrent_list_t *list)
+{
+  clink_t *link = list->first;
+  while (link != NULL)
+    {
+      clink_t *next = link->next;
+      clink_free(link);
+      link = next;
+    }
+  pthread_mutex_destroy(&list->tail_lock);
+  free(list);
+}
+
+void concurrent_list_append(concurrent_list_t *list, const elem_t value)
+{
+  clink_t *link = clink_new(value);
+  if (link == NULL)
+    {
+      puts("Append failed due to memory corruption!");
+      return;
+    }
+  pthread_mutex_lock(&list->tail_lock);
+  clink_t *last = list->last;
+  pthread_mutex_lock(&last->lock);
+  last->next = link;
+  list->last = link;
+  pthread_mutex_unlock(&last->lock);
+  pthread_mutex_unlock(&list->tail_lock);
+  atomic_fetch_add_explicit(&list->size, 1, memory_order_relaxed);
+}
+
+void concurrent_list_prepend(concurrent_list_t *list, const elem_t value)
+{
+  concurrent_list_insert(list, 0, value);
+}
+
+bool concurrent_list_insert(concurrent_list_t *list, const int index, const elem_t value)
+{
+  if (index < 0)
+    {
+      printf("%d is not a valid index!\n", index);
+      return false;
+    }
+  clink_t *link = clink_new(value);
+  if (link == NULL)
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  while (true)
+    {
+      clink_t *before = clist_inner_lock_at(list, (size_t)index);
+      if (before == NULL)
+        {
+          clink_free(link);
+          printf("%d is not a valid index!\n", index);
+          return false;
+        }
+      const bool linked = clist_inner_link_after(list, before, link);
+      pthread_mutex_unlock(&before->lock);
+      if (linked)
+        {
+          return true;
+        }
+      sched_yield();
+    }
+}
+
+bool concurrent_list_remove(concurrent_list_t *list, const int index, elem_t *removed)
+{
+  if (index < 0)
+    {
+      return false;
+    }
+  while (true)
+    {
+      clink_t *before = clist_inner_lock_at(list, (size_t)index);
+      if (before == NULL)
+        {
+          return false;
+        }
+      clink_t *link = before->next;
+      if (link == NULL)
+        {
+          pthread_mutex_unlock(&before->lock);
+          return false;
+        }
+      pthread_mutex_lock(&link->lock);
+      if (link->next == NULL)
+        {
+          if (pthread_mutex_trylock(&list->tail_lock) != 0)
+            {
+              pthread_mutex_unlock(&link->lock);
+              pthread_mutex_unlock(&before->lock);
+              sched_yield();
+              continue;
+            }
+          list->last = before;
+          pthread_mutex_unlock(&list->tail_lock);
+        }
+      before->next = link->next;
+      pthread_mutex_unlock(&link->lock);
+      pthread_mutex_unlock(&before->lock);
+      atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+
+      if (removed != NULL)
+        {
+          *removed = link->value;
+        }
+      clink_free(link);
+      return true;
+    }
+}
+
+bool concurrent_list_pop_front(concurrent_list_t *list, elem_t *removed)
+{
+  return concurrent_list_remove(list, 0, removed);
+}
+
+bool concurrent_list_get(concurrent_list_t *list, const int index, elem_t *value)
+{
+  if (index < 0)
+    {
+      return false;
+    }
+  clink_t *link = clist_inner_lock_at(list, (size_t)index + 1);
+  if (link == NULL)
+    {
+      return false;
+    }
+  *value = link->value;
+  pthread_mutex_unlock(&link->lock);
+
+  return true;
+}
+
+bool concurrent_list_contains(concurrent_list_t *list, const elem_t element)
+{
+  clink_t *link = list->first;
+  pthread_mutex_lock(&link->lock);
+  while (link->next != NULL)
+    {
+      clink_t *next = link->next;
+      pthread_mutex_lock(&next->lock);
+      pthread_mutex_unlock(&link->lock);
+      link = next;
+      if (list->fun(link->value, element))
+        {
+          pthread_mutex_unlock(&link->lock);
+          return true;
+        }
+    }
+  pthread_mutex_unlock(&link->lock);
+
+  return false;
+}
+
+size_t concurrent_list_size(concurrent_list_t *list)
+{
+  return atomic_load_explicit(&list->size, memory_order_relaxed);
+}
+
+bool concurrent_list_is_empty(concurrent_list_t *list)
+{
+  return concurrent_list_size(list) == 0;
+}
+
+void concurrent_list_clear(concurrent_list_t *list)
+{
+  pthread_mutex_lock(&list->tail_lock);
+  clink_t *first = list->first;
+  pthread_mutex_lock(&first->lock);
+  while (first->next != NULL)
+    {
+      clink_t *link = first->next;
+      pthread_mutex_lock(&link->lock);
+      first->next = link->next;
+      pthread_mutex_unlock(&link->lock);
+      clink_free(link);
+      atomic_fetch_sub_explicit(&list->size, 1, memory_order_relaxed);
+    }
+  list->last = first;
+  pthread_mutex_unlock(&first->lock);
+  pthread_mutex_unlock(&list->tail_lock);
+}
+
+bool concurrent_list_all(concurrent_list_t *list, predicate prop, const void *extra)
+{
+  clink_t *link = list->first;
+  pthread_mutex_lock(&link->lock);
+  while (link->next != NULL)
+    {
+      clink_t *next = link->next;
+      pthread_mutex_lock(&next->lock);
+      pthread_mutex_unlock(&link->lock);
+      link = next;
+      if (!prop(link->value, extra))
+        {
+          pthread_mutex_unlock(&link->lock);
+          return false;
+        }
+    }
+  pthread_mutex_unlock(&link->lock);
+
+  return true;
+}
+
+bool concurrent_list_any(concurrent_list_t *list, predicate prop, const void *extra)
+{
+  clink_t *link = list->first;
+  pthread_mutex_lock(&link->lock);
+  while (link->next != NULL)
+    {
+      clink_t *next = link->next;
+      pthread_mutex_lock(&next->lock);
+      pthread_mutex_unlock(&link->lock);
+      link = next;
+      if (prop(link->value, extra))
+        {
+          pthread_mutex_unlock(&link->lock);
+          return true;
+        }
+    }
+  pthread_mutex_unlock(&link->lock);
+
+  return false;
+}
+
+void concurrent_list_apply_to_all(concurrent_list_t *list, apply_function fun, const void *extra)
+{
+  clink_t *link = list->first;
+  pthread_mutex_lock(&link->lock);
+  while (link->next != NULL)
+    {
+      clink_t *next = link->next;
+      pthread_mutex_lock(&next->lock);
+      pthread_mutex_unlock(&link->lock);
+      link = next;
+      fun(&link->value, extra);
+    }
+  pthread_mutex_unlock(&link->lock);
+}
@@ -0,0 +1,209 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "hash_index.h"
+
+/**
+ * @file hash_index.c
+ * @brief Implementation of the hash index for linked lists.
+ *
+ * This file contains the implementation of the hash index functions defined in
+ * hash_index.h. The detailed descriptions of the functions are provided in the
+ * header file.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Number of slots of a newly created index, a power of two.
+#define HASH_INDEX_INITIAL_CAPACITY 16
+
+/// Slot of the hash table.
+typedef struct hash_slot
+{
+  elem_t key;     // Element.
+  size_t hash;    // Hash of the element.
+  size_t count;   // Number of occurrences, 0 for an empty slot.
+} hash_slot_t;
+
+/// Hash index counting the occurrences of elements.
+struct hash_index
+{
+  hash_slot_t *slots;   // Table of slots.
+  size_t capacity;      // Number of slots, a power of two.
+  size_t used;          // Number of non-empty slots.
+  hash_function hash;   // Hash function for elements.
+  eq_function eq;       // Function pointer for element equality comparison.
+};
+
+/**
+ * @brief Find the slot holding an element, or the empty slot where it belongs.
+ * @param index The index.
+ * @param value The element.
+ * @param hash The hash of the element.
+ * @return The position of the slot.
+ **/
+static size_t hash_index_inner_find(hash_index_t *index, const elem_t value, const size_t hash);
+
+/**
+ * @brief Double the number of slots and reinsert all elements.
+ * @param index The index.
+ * @return True if the table was grown, false if memory allocation failed.
+ **/
+static bool hash_index_inner_grow(hash_index_t *index);
+
+/**
+ * @brief Find the slot holding an element, or the empty slot where it belongs.
+ * @param index The index.
+ * @param value The element.
+ * @param hash The hash of the element.
+ * @return The position of the slot.
+ **/
+static size_t hash_index_inner_find(hash_index_t *index, const elem_t value, const size_t hash)
+{
+  const size_t mask = index->capacity - 1;
+  size_t position = hash & mask;
+  while (index->slots[position].count > 0)
+    {
+      const hash_slot_t *slot = &index->slots[position];
+      if (slot->hash == hash && index->eq(slot->key, value))
+        {
+          break;
+        }
+      position = (position + 1) & mask;
+    }
+
+  return position;
+}
+
+/**
+ * @brief Double the number of slots and reinsert all elements.
+ * @param index The index.
+ * @return True if the table was grown, false if memory allocation failed.
+ **/
+static bool hash_index_inner_grow(hash_index_t *index)
+{
+  hash_slot_t *old_slots = index->slots;
+  const size_t old_capacity = index->capacity;
+  hash_slot_t *slots = calloc(old_capacity * 2, sizeof(hash_slot_t));
+  if (slots == NULL)
+    {
+      puts("Failed to allocate memory for a larger hash index.");
+      return false;
+    }
+  index->slots = slots;
+  index->capacity = old_capacity * 2;
+
+  const size_t mask = index->capacity - 1;
+  for (size_t i = 0; i < old_capacity; ++i)
+    {
+      if (old_slots[i].count > 0)
+        {
+          size_t position = old_slots[i].hash & mask;
+          while (slots[position].count > 0)
+            {
+              position = (position + 1) & mask;
+            }
+          slots[position] = old_slots[i];
+        }
+    }
+  free(old_slots);
+
+  return true;
+}
+
+hash_index_t *hash_index_create(hash_function hash, eq_function eq)
+{
+  hash_index_t *index = calloc(1, sizeof(hash_index_t));
+  if (index == NULL)
+    {
+      puts("Failed to allocate memory for a hash index.");
+      return NULL;
+    }
+  index->slots = calloc(HASH_INDEX_INITIAL_CAPACITY, sizeof(hash_slot_t));
+  if (index->slots == NULL)
+    {
+      puts("Failed to allocate memory for a hash index.");
+      free(index);
+      return NULL;
+    }
+  index->capacity = HASH_INDEX_INITIAL_CAPACITY;
+  index->hash = hash;
+  index->eq = eq;
+
+  return index;
+}
+
+void hash_index_destroy(hash_index_t *index)
+{
+  free(index->slots);
+  free(index);
+}
+
+bool hash_index_add(hash_index_t *index, const elem_t value)
+{
+  if ((index->used + 1) * 4 > index->capacity * 3 && !hash_index_inner_grow(index))
+    {
+      return false;
+    }
+  const size_t hash = index->hash(value);
+  hash_slot_t *slot = &index->slots[hash_index_inner_find(index, value, hash)];
+  if (slot->count == 0)
+    {
+      slot->key = value;
+      slot->hash = hash;
+      index->used += 1;
+    }
+  slot->count += 1;
+
+  return true;
+}
+
+void hash_index_remove(hash_index_t *index, const elem_t value)
+{
+  const size_t mask = index->capacity - 1;
+  size_t hole = hash_index_inner_find(index, value, index->hash(value));
+  if (index->slots[hole].count == 0)
+    {
+      return;
+    }
+  index->slots[hole].count -= 1;
+  if (index->slots[hole].count > 0)
+    {
+      return;
+    }
+  index->used -= 1;
+
+  // Shift later members of the probe sequence back, so that no lookup stops early at the hole.
+  size_t position = (hole + 1) & mask;
+  while (index->slots[position].count > 0)
+    {
+      const size_t home = index->slots[position].hash & mask;
+      if (((position - home) & mask) >= ((position - hole) & mask))
+        {
+          index->slots[hole] = index->slots[position];
+          index->slots[position].count = 0;
+          hole = position;
+        }
+      position = (position + 1) & mask;
+    }
+}
+
+bool hash_index_contains(hash_index_t *index, const elem_t value)
+{
+  const size_t position = hash_index_inner_find(index, value, index->hash(value));
+  return index->slots[position].count > 0;
+}
+
+void hash_index_clear(hash_index_t *index)
+{
+  for (size_t i = 0; i < index->capacity; ++i)
+    {
+      index->slots[i].count = 0;
+    }
+  index->used = 0;
+}
+
+hash_function hash_index_function(hash_index_t *index)
+{
+  return index->hash;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "linked_list.h"
+
+/**
+ * @file hash_index.h
+ * @brief Hash index counting the occurrences of elements in a linked list.
+ *
+ * This header file is private to the implementation. It defines a hash table
+ * that maps every distinct element of a list to its number of occurrences, so
+ * that membership can be answered in expected O(1) time. The table uses open
+ * addressing with linear probing and backward shift deletion.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Hash index counting the occurrences of elements.
+typedef struct hash_index hash_index_t;
+
+/**
+ * @brief Create a new empty hash index.
+ * @param hash Hash function for elements, consistent with eq.
+ * @param eq Function pointer for element equality comparison.
+ * @return A pointer to an empty index, or NULL if memory allocation failed.
+ **/
+hash_index_t *hash_index_create(hash_function hash, eq_function eq);
+
+/**
+ * @brief Destroy a hash index and free its memory.
+ * @param index The index to be destroyed.
+ **/
+void hash_index_destroy(hash_index_t *index);
+
+/**
+ * @brief Record one more occurrence of an element.
+ * @param index The index.
+ * @param value The element.
+ * @return True if the occurrence was recorded, false if memory allocation failed.
+ **/
+bool hash_index_add(hash_index_t *index, const elem_t value);
+
+/**
+ * @brief Forget one occurrence of an element.
+ * @param index The index.
+ * @param value The element, which must have been recorded.
+ **/
+void hash_index_remove(hash_index_t *index, const elem_t value);
+
+/**
+ * @brief Check if an element has at least one recorded occurrence.
+ * @param index The index.
+ * @param value The element sought.
+ * @return True if the element is recorded, false otherwise.
+ **/
+bool hash_index_contains(hash_index_t *index, const elem_t value);
+
+/**
+ * @brief Forget all recorded occurrences.
+ * @param index The index.
+ **/
+void hash_index_clear(hash_index_t *index);
+
+/**
+ * @brief Get the hash function of a hash index.
+ * @param index The index.
+ * @return The hash function that the index was created with.
+ **/
+hash_function hash_index_function(hash_index_t *index);
@@ -0,0 +1,314 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "hazard.h"
+
+/**
+ * @file hazard.c
+ * @brief Implementation of hazard pointers.
+ *
+ * Records form a global list that only ever grows. A thread frees its retired
+ * nodes in batches: once it has retired at least twice as many nodes as there
+ * are slots in all records, it collects the published pointers of all records
+ * and frees every retired node that is not among them, which takes amortised
+ * O(1) time per node.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Smallest number of retired nodes that triggers an attempt to free them.
+#define HAZARD_MIN_BATCH 64
+
+/// Node waiting to be freed.
+typedef struct retired
+{
+  void *node;                 // The node.
+  void (*deleter)(void *);    // Function that frees the node.
+} retired_t;
+
+/// Hazard record of a thread.
+struct hazard_record
+{
+  _Atomic(void *) slots[HAZARD_SLOTS]; // Published pointers.
+  atomic_bool active;                  // True while a thread owns the record.
+  hazard_record_t *next;               // Next record, fixed once the record is published.
+  retired_t *retired;                  // Nodes retired by the owner.
+  size_t retired_count;                // Number of retired nodes.
+  size_t retired_capacity;             // Capacity of retired.
+};
+
+/// First record of the global list of records.
+static _Atomic(hazard_record_t *) hazard_records = NULL;
+
+/// Number of records in the global list.
+static atomic_size_t hazard_record_count = 0;
+
+/// Record owned by the calling thread.
+static _Thread_local hazard_record_t *hazard_local = NULL;
+
+/// Key whose destructor releases the record of an exiting thread.
+static pthread_key_t hazard_key;
+
+/// Guard for creating hazard_key.
+static pthread_once_t hazard_key_once = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Release the record of an exiting thread, freeing what can be freed.
+ * @param data The record.
+ **/
+static void hazard_inner_release(void *data);
+
+/**
+ * @brief Create the key that releases records when threads exit.
+ **/
+static void hazard_inner_create_key(void);
+
+/**
+ * @brief Check if a pointer is published in a sorted array of pointers.
+ * @param hazards The sorted published pointers.
+ * @param count The number of published pointers.
+ * @param node The pointer sought.
+ * @return True if node is published, false otherwise.
+ **/
+static bool hazard_inner_published(void *const *hazards, const size_t count, const void *node);
+
+/**
+ * @brief Compare two pointers for qsort.
+ * @param a The first pointer.
+ * @param b The second pointer.
+ * @return A negative, zero or positive number as a is below, equal to or above b.
+ **/
+static int hazard_inner_compare(const void *a, const void *b);
+
+/**
+ * @brief Remove the mark from a pointer.
+ * @param pointer A pointer that may carry a mark in its lowest bit.
+ * @return The pointer without the mark.
+ **/
+static void *hazard_inner_unmark(void *pointer);
+
+/**
+ * @brief Remove the mark from a pointer.
+ * @param pointer A pointer that may carry a mark in its lowest bit.
+ * @return The pointer without the mark.
+ **/
+static void *hazard_inner_unmark(void *pointer)
+{
+  return (void *)((uintptr_t)pointer & ~(uintptr_t)1);
+}
+
+/**
+ * @brief Compare two pointers for qsort.
+ * @param a The first pointer.
+ * @param b The second pointer.
+ * @return A negative, zero or positive number as a is below, equal to or above b.
+ **/
+static int hazard_inner_compare(const void *a, const void *b)
+{
+  const uintptr_t x = (uintptr_t)*(void *const *)a;
+  const uintptr_t y = (uintptr_t)*(void *const *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Check if a pointer is published in a sorted array of pointers.
+ * @param hazards The sorted published pointers.
+ * @param count The number of published pointers.
+ * @param node The pointer sought.
+ * @return True if node is published, false otherwise.
+ **/
+static bool hazard_inner_published(void *const *hazards, const size_t count, const void *node)
+{
+  size_t low = 0;
+  size_t high = count;
+  while (low < high)
+    {
+      const size_t middle = low + (high - low) / 2;
+      if ((uintptr_t)hazards[middle] < (uintptr_t)node)
+        {
+          low = middle + 1;
+        }
+      else
+        {
+          high = middle;
+        }
+    }
+  return low < count && hazards[low] == node;
+}
+
+/**
+ * @brief Create the key that releases records when threads exit.
+ **/
+static void hazard_inner_create_key(void)
+{
+  pthread_key_create(&hazard_key, hazard_inner_release);
+}
+
+/**
+ * @brief Release the record of an exiting thread, freeing what can be freed.
+ * @param data The record.
+ **/
+static void hazard_inner_release(void *data)
+{
+  hazard_record_t *record = data;
+  hazard_clear(record);
+  hazard_collect(record);
+  atomic_store_explicit(&record->active, false, memory_order_release);
+}
+
+hazard_record_t *hazard_record(void)
+{
+  if (hazard_local != NULL)
+    {
+      return hazard_local;
+    }
+  pthread_once(&hazard_key_once, hazard_inner_create_key);
+
+  // Take over a record released by an exited thread, or publish a new one.
+  hazard_record_t *record = atomic_load_explicit(&hazard_records, memory_order_acquire);
+  for (; record != NULL; record = record->next)
+    {
+      bool inactive = false;
+      if (atomic_compare_exchange_strong(&record->active, &inactive, true))
+        {
+          break;
+        }
+    }
+  if (record == NULL)
+    {
+      record = calloc(1, sizeof(hazard_record_t));
+      if (record == NULL)
+        {
+          puts("Failed to allocate memory for a hazard record.");
+          return NULL;
+        }
+      atomic_init(&record->active, true);
+      for (size_t i = 0; i < HAZARD_SLOTS; ++i)
+        {
+          atomic_init(&record->slots[i], NULL);
+        }
+      hazard_record_t *head = atomic_load_explicit(&hazard_records, memory_order_relaxed);
+      do
+        {
+          record->next = head;
+        }
+      while (!atomic_compare_exchange_weak_explicit(&hazard_records, &head, record,
+                                                    memory_order_release, memory_order_relaxed));
+      atomic_fetch_add(&hazard_record_count, 1);
+    }
+  pthread_setspecific(hazard_key, record);
+  hazard_local = record;
+
+  return record;
+}
+
+void *hazard_protect(hazard_record_t *record, const size_t slot, _Atomic(void *) *source)
+{
+  void *pointer = atomic_load(source);
+  while (true)
+    {
+      atomic_store(&record->slots[slot], hazard_inner_unmark(pointer));
+      void *confirmed = atomic_load(source);
+      if (confirmed == pointer)
+        {
+          return pointer;
+        }
+      pointer = confirmed;
+    }
+}
+
+void hazard_set(hazard_record_t *record, const size_t slot, void *pointer)
+{
+  atomic_store(&record->slots[slot], hazard_inner_unmark(pointer));
+}
+
+void hazard_clear(hazard_record_t *record)
+{
+  for (size_t i = 0; i < HAZARD_SLOTS; ++i)
+    {
+      atomic_store_explicit(&record->slots[i], NULL, memory_order_release);
+    }
+}
+
+void hazard_retire(hazard_record_t *record, void *node, void (*deleter)(void *))
+{
+  if (record->retired_count == record->retired_capacity)
+    {
+      const size_t capacity = record->retired_capacity ? 2 * record->retired_capacity : HAZARD_MIN_BATCH;
+      retired_t *retired = realloc(record->retired, capacity * sizeof(retired_t));
+      if (retired == NULL)
+        {
+          // Leak the node rather than free it while it may still be in use.
+          puts("Failed to allocate memory for a retired node.");
+          return;
+        }
+      record->retired = retired;
+      record->retired_capacity = capacity;
+    }
+  record->retired[record->retired_count++] = (retired_t) { .node = node, .deleter = deleter };
+
+  const size_t threshold = 2 * HAZARD_SLOTS * atomic_load(&hazard_record_count);
+  if (record->retired_count >= (threshold > HAZARD_MIN_BATCH ? threshold : HAZARD_MIN_BATCH))
+    {
+      hazard_collect(record);
+    }
+}
+
+void hazard_collect(hazard_record_t *record)
+{
+  if (record->retired_count == 0)
+    {
+      return;
+    }
+  size_t capacity = HAZARD_SLOTS * atomic_load(&hazard_record_count);
+  void **hazards = malloc(capacity * sizeof(void *));
+  if (hazards == NULL)
+    {
+      return;
+    }
+  size_t count = 0;
+  for (hazard_record_t *other = atomic_load_explicit(&hazard_records, memory_order_acquire);
+       other != NULL;
+       other = other->next)
+    {
+      if (count + HAZARD_SLOTS > capacity)
+        {
+          // Records published since the count was read.
+          void **grown = realloc(hazards, 2 * capacity * sizeof(void *));
+          if (grown == NULL)
+            {
+              free(hazards);
+              return;
+            }
+          hazards = grown;
+          capacity *= 2;
+        }
+      for (size_t i = 0; i < HAZARD_SLOTS; ++i)
+        {
+          void *hazard = atomic_load(&other->slots[i]);
+          if (hazard != NULL)
+            {
+              hazards[count++] = hazard;
+            }
+        }
+    }
+  qsort(hazards, count, sizeof(void *), hazard_inner_compare);
+
+  size_t kept = 0;
+  for (size_t i = 0; i < record->retired_count; ++i)
+    {
+      const retired_t retired = record->retired[i];
+      if (hazard_inner_published(hazards, count, retired.node))
+        {
+          record->retired[kept++] = retired;
+        }
+      else
+        {
+          retired.deleter(retired.node);
+        }
+    }
+  record->retired_count = kept;
+  free(hazards);
+}
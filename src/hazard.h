@@ -0,0 +1,78 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+/**
+ * @file hazard.h
+ * @brief Hazard pointers for safe memory reclamation in lock-free structures.
+ *
+ * This header file is private to the implementation. Every thread owns a
+ * hazard record with a few slots, in which it publishes the nodes it is about
+ * to dereference. A node that has been unlinked from a lock-free structure is
+ * retired rather than freed, and is only freed once no slot of any thread
+ * refers to it. Records are acquired on first use and released again when the
+ * thread exits, after which another thread may take them over together with
+ * the nodes still waiting in them.
+ *
+ * Pointers may carry a mark in their lowest bit, which is ignored when they
+ * are published and compared.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Number of hazard slots of every thread.
+#define HAZARD_SLOTS 3
+
+/// Hazard record of a thread.
+typedef struct hazard_record hazard_record_t;
+
+/**
+ * @brief Get the hazard record of the calling thread, acquiring one on first use.
+ * @return The record, or NULL if memory allocation failed.
+ **/
+hazard_record_t *hazard_record(void);
+
+/**
+ * @brief Load a pointer and protect the node it refers to.
+ *
+ * The pointer is loaded from source and published in a slot until it is
+ * confirmed that source still holds it, so that the node cannot have been
+ * freed in between.
+ *
+ * @param record The record of the calling thread.
+ * @param slot The slot to publish the pointer in, in [0, HAZARD_SLOTS).
+ * @param source The location to load the pointer from.
+ * @return The loaded pointer, including its mark.
+ **/
+void *hazard_protect(hazard_record_t *record, const size_t slot, _Atomic(void *) *source);
+
+/**
+ * @brief Publish a pointer that is already known to be protected, for example by another slot.
+ * @param record The record of the calling thread.
+ * @param slot The slot to publish the pointer in.
+ * @param pointer The pointer, or NULL to clear the slot.
+ **/
+void hazard_set(hazard_record_t *record, const size_t slot, void *pointer);
+
+/**
+ * @brief Clear all slots of a record.
+ * @param record The record of the calling thread.
+ **/
+void hazard_clear(hazard_record_t *record);
+
+/**
+ * @brief Retire a node that has been unlinked, so that it is freed once it is no longer protected.
+ * @param record The record of the calling thread.
+ * @param node The node, which no thread can reach from the structure any more.
+ * @param deleter The function that frees the node.
+ **/
+void hazard_retire(hazard_record_t *record, void *node, void (*deleter)(void *));
+
+/**
+ * @brief Free all nodes retired by the calling thread that are no longer protected.
+ * @param record The record of the calling thread.
+ **/
+void hazard_collect(hazard_record_t *record);
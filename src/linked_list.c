@@ -1,7 +1,20 @@
 #include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
 #include "linked_list.h"
 #include "iterator.h"
+#include "pool.h"
+#include "list_engine.h"
+#include "hash_index.h"
+#include "skip_index.h"
 
 /**
  * @file linked_list.c
@@ -17,39 +30,192 @@
  * @author Marcus Enderskog
  **/
 
-/// Link pointer to an element stored in a linked list.
-typedef struct link link_t;
+/// Longest walk from the cursor that is preferred over a lookup in the skip index.
+#define LIST_CURSOR_WALK_LIMIT 16
 
-/// Link pointer to an element stored in a linked list.
-struct link
+/// Number of runs of elements per thread in a parallel operation, so that threads that finish early can take more.
+#define LIST_PARALLEL_CHUNKS_PER_THREAD 4
+
+/// Characters at the start of a file written by linked_list_save.
+#define LIST_FILE_MAGIC "LLSTFILE"
+/// Version of the format of files written by linked_list_save.
+#define LIST_FILE_VERSION 1
+/// Number written in the byte order of the machine that wrote a list file.
+#define LIST_FILE_BYTE_ORDER 0x01020304
+/// Number of elements or links that linked_list_save buffers before writing them.
+#define LIST_FILE_BLOCK 4096
+
+/// Header of a file written by linked_list_save, followed by the slots of the compact layout.
+typedef struct list_file_header
 {
-  elem_t value;   // Element value.
-  link_t *next;   // Next element.
-};
+  char magic[8];          // LIST_FILE_MAGIC, without a terminating null character.
+  uint32_t version;       // LIST_FILE_VERSION.
+  uint32_t byte_order;    // LIST_FILE_BYTE_ORDER, as written by the machine that wrote the file.
+  uint32_t elem_size;     // Size of elem_t on the machine that wrote the file.
+  uint32_t eq_kind;       // Built-in equality comparison of the saved list.
+  uint64_t size;          // Number of elements.
+  uint64_t values;        // Offset of the element of every slot, starting with the sentinel in slot 0.
+  uint64_t next;          // Offset of the next slot of every slot, as 32-bit indices.
+  uint32_t last;          // Slot of the last element, or 0 if there is none.
+  uint32_t reserved[3];   // Zero, rounding the header up to 64 bytes.
+} list_file_header_t;
+
+_Static_assert(sizeof(list_file_header_t) == 64, "list file headers must take 64 bytes");
+
+/// Characters at the start of a stream written by linked_list_write_fd.
+#define LIST_STREAM_MAGIC "LLSTSTRM"
 
-/// Linked list structure for holding generic elements.
-struct list
+/// Header of a stream written by linked_list_write_fd, followed by the elements in order.
+typedef struct list_stream_header
 {
-  link_t *first;    // Pointer to first element in a linked list.
-  link_t *last;     // Pointer to last element in a linked list.
-  size_t size;      // Number of elements stored in a linked list.
-  eq_function fun;  // Function pointer for element equality comparison.
-};
+  char magic[8];          // LIST_STREAM_MAGIC, without a terminating null character.
+  uint32_t version;       // LIST_FILE_VERSION.
+  uint32_t byte_order;    // LIST_FILE_BYTE_ORDER, as written by the machine that wrote the stream.
+  uint32_t elem_size;     // Size of elem_t on the machine that wrote the stream.
+  uint32_t eq_kind;       // Built-in equality comparison of the written list.
+  uint64_t size;          // Number of elements.
+} list_stream_header_t;
 
-/// Iterator for a linked list.
-struct iter
+/// Fewest accesses that an adaptive list counts before it weighs them, so that small lists do not flip back and forth.
+#define LIST_ADAPTIVE_MIN_WINDOW 256
+
+/// Elements per access counted before an adaptive list weighs them, which bounds the elements moved per access.
+#define LIST_ADAPTIVE_ELEMENTS_PER_ACCESS 16
+
+/// State shared by the threads of a parallel operation.
+typedef struct list_parallel
 {
-  link_t *current;  // Pointer to the current link.
-  list_t* list;     // The linked list itself.
-};
+  list_t *list;           // The linked list.
+  list_chunk_t *chunks;   // Runs of elements, one per chunk of the task.
+  predicate prop;         // Property to test, or NULL to apply fun instead.
+  apply_function fun;     // Function to apply.
+  const void *extra;      // Additional argument of prop or fun.
+  bool sought;            // Result of prop that decides the outcome of the operation.
+  atomic_bool found;      // Set once prop gave the sought result, which stops all threads.
+  atomic_size_t calls;    // Number of calls of prop, summed over the runs.
+  atomic_size_t nodes;    // Number of links or storage nodes visited, summed over the runs.
+} list_parallel_t;
+
+/// Scan the links of a list for an element by comparing one member directly.
+#define LIST_SCAN(list, element, member)                                              \
+  for (const link_t *cursor = (list)->first->next; cursor; cursor = cursor->next)    \
+    {                                                                                 \
+      if (cursor->value.member == (element).member)                                   \
+        {                                                                             \
+          return true;                                                                \
+        }                                                                             \
+    }                                                                                 \
+  return false
 
 /**
  * @brief Create a new link.
+ * @param list The list whose allocator the link is taken from.
  * @param value Element value to set.
  * @param next The next link.
  * @return A pointer to the newly created link, or NULL if memory allocation failed.
  **/
-static link_t *link_new(const elem_t value, link_t *next);
+static link_t *link_new(list_t *list, const elem_t value, link_t *next);
+
+/**
+ * @brief Release a link back to the allocator of a list.
+ * @param list The list whose allocator the link was taken from.
+ * @param link The link to release.
+ **/
+static void link_free(list_t *list, link_t *link);
+
+/**
+ * @brief Create a chain of new links with undefined values.
+ * @param list The list whose allocator the links are taken from.
+ * @param count Number of links to create (must be greater than 0).
+ * @param tail Set to the last link of the chain, whose next link is NULL.
+ * @return The first link of the chain, or NULL if memory allocation failed.
+ **/
+static link_t *link_chain_new(list_t *list, const size_t count, link_t **tail);
+
+/**
+ * @brief Get the size of the links of a list.
+ * @param doubly True for a doubly linked list.
+ * @return The size in bytes of a link.
+ **/
+static size_t link_size(const bool doubly);
+
+/**
+ * @brief Move the cursor of a list back to the sentinel.
+ *
+ * This must be done whenever links may have been removed or moved without
+ * the cursor being updated.
+ *
+ * @param list The linked list.
+ **/
+static void list_inner_cursor_reset(list_t *list);
+
+/**
+ * @brief Set the previous link of a link, if the list is doubly linked.
+ * @param list The list the link belongs to.
+ * @param link The link to update.
+ * @param prev The new previous link.
+ **/
+static void link_set_prev(list_t *list, link_t *link, link_t *prev);
+
+/**
+ * @brief Find the link preceding a given link.
+ * @param list The linked list.
+ * @param link A link of the list other than the sentinel.
+ * @return The preceding link, found in O(1) time for a doubly linked list and O(n) time otherwise.
+ **/
+static link_t *list_inner_link_preceding(list_t *list, link_t *link);
+
+/**
+ * @brief Attach a chain of links after a given link of a list.
+ *
+ * The last link and the previous links are kept up to date, while the size and
+ * the indices of the list are left to the caller.
+ *
+ * @param list The linked list.
+ * @param before The link to attach the chain after.
+ * @param head The first link of the chain.
+ * @param tail The last link of the chain.
+ **/
+static void list_inner_link_after(list_t *list, link_t *before, link_t *head, link_t *tail);
+
+/**
+ * @brief Detach the link following a given link of a list.
+ *
+ * The last link and the previous links are kept up to date, while the size and
+ * the indices of the list are left to the caller.
+ *
+ * @param list The linked list.
+ * @param before The link preceding the link to detach, which must exist.
+ * @return The detached link.
+ **/
+static link_t *list_inner_unlink_after(list_t *list, link_t *before);
+
+/**
+ * @brief Record an element added to a list in its hash index, if it has one.
+ * @param list The linked list.
+ * @param value The element added.
+ **/
+static void list_inner_index_add(list_t *list, const elem_t value);
+
+/**
+ * @brief Forget an element removed from a list in its hash index, if it has one.
+ * @param list The linked list.
+ * @param value The element removed.
+ **/
+static void list_inner_index_remove(list_t *list, const elem_t value);
+
+/**
+ * @brief Rebuild the hash index of a list from its elements, if it has one.
+ * @param list The linked list.
+ **/
+static void list_inner_index_rebuild(list_t *list);
+
+/**
+ * @brief Record links just attached to the end of a list in its skip index, if it has one.
+ * @param list The linked list, whose size already counts the new links.
+ * @param head The first of the new links, which run to the end of the list.
+ **/
+static void list_inner_skip_push_back(list_t *list, link_t *head);
 
 /**
  * @brief Check and adjust a provided linked list index.
@@ -59,6 +225,216 @@ static link_t *link_new(const elem_t value, link_t *next);
  **/
 static int list_inner_adjust_index(const int index, const size_t upper_bound);
 
+/**
+ * @brief Get the eq_function performing a built-in equality comparison.
+ * @param kind The built-in comparison.
+ * @return The function, or NULL for LIST_EQ_CUSTOM.
+ **/
+static eq_function list_inner_eq_function(const list_eq_kind_t kind);
+
+/**
+ * @brief Find the link preceding the element at a given position.
+ *
+ * The search resumes from the cursor of the list when possible, and leaves the
+ * cursor at the link found, so that sequential positional access takes amortised
+ * O(1) time.
+ *
+ * @param list The linked list.
+ * @param index A valid position in the list.
+ * @return The link preceding the element at index, which is the sentinel for index 0.
+ **/
+static link_t *list_inner_link_before(list_t *list, const size_t index);
+
+/**
+ * @brief Cut a non-empty list into runs of consecutive elements of about equal length.
+ * @param list The linked list.
+ * @param chunks The runs to fill in.
+ * @param count The number of runs, at most the number of elements.
+ * @return The number of runs filled in.
+ **/
+static size_t list_inner_split(list_t *list, list_chunk_t *chunks, const size_t count);
+
+/**
+ * @brief Take the next element of a run.
+ * @param list The linked list the run belongs to.
+ * @param chunk The run.
+ * @return A pointer to the element, or NULL once the run is exhausted.
+ **/
+static elem_t *list_inner_chunk_next(list_t *list, list_chunk_t *chunk);
+
+/**
+ * @brief Test or update the elements of one run of a parallel operation.
+ * @param arg The state of the operation.
+ * @param chunk The index of the run.
+ **/
+static void list_inner_parallel_chunk(void *arg, const size_t chunk);
+
+/**
+ * @brief Split a non-empty list into runs and process them on the threads of a pool.
+ * @param list The linked list.
+ * @param pool The threads, or NULL to process the runs on the calling thread.
+ * @param parallel The operation, whose remaining fields are filled in.
+ **/
+static void list_inner_parallel(list_t *list, thread_pool_t *pool, list_parallel_t *parallel);
+
+/**
+ * @brief Cut a chain of links after a given number of links.
+ * @param head The first link of the chain, or NULL.
+ * @param count The number of links to keep, at least 1.
+ * @return The first link after the cut, or NULL if the chain was not longer than count.
+ **/
+static link_t *list_inner_cut(link_t *head, const size_t count);
+
+/**
+ * @brief Merge two sorted chains of links, preferring the first chain on ties.
+ * @param cmp The comparison function that orders the elements.
+ * @param tail The link to attach the merged chain to.
+ * @param left The first sorted chain, which is not empty.
+ * @param right The second sorted chain, or NULL.
+ * @return The last link of the merged chain.
+ **/
+static link_t *list_inner_merge(cmp_function cmp, link_t *tail, link_t *left, link_t *right);
+
+/**
+ * @brief Check if two lists can exchange links, because they take them from the same place.
+ * @param list The first linked list.
+ * @param other The second linked list.
+ * @return True if a link of either list may be moved to the other, false otherwise.
+ **/
+static bool list_inner_shares_links(list_t *list, list_t *other);
+
+/**
+ * @brief Get options that create an empty list like a given list.
+ * @param list The linked list.
+ * @param options The options to fill in.
+ **/
+static void list_inner_options(list_t *list, list_options_t *options);
+
+/**
+ * @brief Move a chain of links from one list to another, or within a list.
+ *
+ * The lists must share their links. Both sizes, hash indices, skip indices,
+ * cursors, last links and previous links are kept up to date. A cursor that
+ * stays in front of the links moved keeps its place.
+ *
+ * @param list The list that the chain is moved to.
+ * @param before The link to attach the chain after, which is not part of the chain.
+ * @param source The list that the chain is moved from, which may be list.
+ * @param source_before The link preceding the chain in source.
+ * @param tail The last link of the chain.
+ * @param count The number of links in the chain.
+ **/
+static void list_inner_move_after(list_t *list, link_t *before, list_t *source, link_t *source_before,
+                                  link_t *tail, const size_t count);
+
+/**
+ * @brief Remove in one pass the elements for which a predicate returns a given result.
+ * @param list The linked list.
+ * @param prop The predicate.
+ * @param extra Additional argument passed to the predicate.
+ * @param matching The result of the predicate for the elements to remove.
+ * @return The number of elements removed.
+ **/
+static size_t list_inner_filter(list_t *list, predicate prop, const void *extra, const bool matching);
+
+/**
+ * @brief Count an access to an adaptive list, and change its layout once the accesses call for it.
+ *
+ * Nothing is done for a list with a fixed layout. The accesses are weighed once
+ * there are at least one per LIST_ADAPTIVE_ELEMENTS_PER_ACCESS elements, so that
+ * the cost of a move is spread over the accesses that led to it, while a list
+ * in the wrong layout, where each access may take O(n) time, moves soon.
+ *
+ * @param list The linked list.
+ * @param positional True for an access by position away from both ends, false for an access at either end.
+ **/
+static void list_inner_adapt(list_t *list, const bool positional);
+
+/**
+ * @brief Move the elements of a list from its links into the array engine.
+ * @param list The linked list, which must not have an engine.
+ * @return True on success, false if memory allocation failed, in which case the list is left unchanged.
+ **/
+static bool list_inner_to_array(list_t *list);
+
+/**
+ * @brief Move the elements of a list from the array engine back into links.
+ * @param list The linked list, which must use the array engine.
+ * @return True on success, false if memory allocation failed, in which case the list is left unchanged.
+ **/
+static bool list_inner_to_linked(list_t *list);
+
+/**
+ * @brief Check that a mapped file holds a list written by linked_list_save on a machine of the same kind.
+ * @param header The start of the mapping.
+ * @param length The length of the mapping in bytes, at least the size of a header.
+ * @return True if the header is valid and the slots it describes lie within the mapping.
+ *         The links held in the slots are not checked.
+ **/
+static bool list_inner_file_valid(const list_file_header_t *header, const size_t length);
+
+/**
+ * @brief Write buffers to a file descriptor, retrying partial writes and interrupted calls.
+ * @param fd The file descriptor.
+ * @param iov The buffers, which are updated as they are written.
+ * @param count The number of buffers.
+ * @return True once all bytes are written, false if a write failed.
+ **/
+static bool list_inner_write_all(const int fd, struct iovec *iov, int count);
+
+/**
+ * @brief Read an exact number of bytes from a file descriptor, retrying short reads and interrupted calls.
+ * @param fd The file descriptor.
+ * @param buffer The buffer to read into.
+ * @param length The number of bytes to read.
+ * @return True once all bytes are read, false if a read failed or the stream ended first.
+ **/
+static bool list_inner_read_all(const int fd, void *buffer, size_t length);
+
+static bool eq_int(const elem_t a, const elem_t b)
+{
+  return a.i == b.i;
+}
+
+static bool eq_unsigned(const elem_t a, const elem_t b)
+{
+  return a.u == b.u;
+}
+
+static bool eq_bool(const elem_t a, const elem_t b)
+{
+  return a.b == b.b;
+}
+
+static bool eq_float(const elem_t a, const elem_t b)
+{
+  return a.f == b.f;
+}
+
+static bool eq_pointer(const elem_t a, const elem_t b)
+{
+  return a.p == b.p;
+}
+
+/**
+ * @brief Get the eq_function performing a built-in equality comparison.
+ * @param kind The built-in comparison.
+ * @return The function, or NULL for LIST_EQ_CUSTOM.
+ **/
+static eq_function list_inner_eq_function(const list_eq_kind_t kind)
+{
+  switch (kind)
+    {
+    case LIST_EQ_INT: return eq_int;
+    case LIST_EQ_UNSIGNED: return eq_unsigned;
+    case LIST_EQ_BOOL: return eq_bool;
+    case LIST_EQ_FLOAT: return eq_float;
+    case LIST_EQ_POINTER: return eq_pointer;
+    case LIST_EQ_CUSTOM: break;
+    }
+  return NULL;
+}
+
 /**
  * @brief Check and adjust a provided linked list index.
  * @param index The provided index to check and adjust.
@@ -85,131 +461,1545 @@ static int list_inner_adjust_index(const int index, const size_t upper_bound)
 }
 
 /**
- * @brief Create a new link.
- * @param value Element value to set.
- * @param next The next link.
- * @return A pointer to the newly created link, or NULL if memory allocation failed.
+ * @brief Find the link preceding the element at a given position.
+ *
+ * The search resumes from the cursor of the list when possible, and leaves the
+ * cursor at the link found, so that sequential positional access takes amortised
+ * O(1) time.
+ *
+ * @param list The linked list.
+ * @param index A valid position in the list.
+ * @return The link preceding the element at index, which is the sentinel for index 0.
  **/
-static link_t *link_new(const elem_t value, link_t *next)
-{
-  link_t *new = calloc(1, sizeof(link_t));
-  if (new == NULL)
-  {
-    puts("Failed to allocate memory for another link.");
-    return NULL;
-  }
-  new->value = value;
-  new->next = next;
-
-  return new;
-}
-
-list_iterator_t *list_iterator(list_t *list)
+static link_t *list_inner_link_before(list_t *list, const size_t index)
 {
-  list_iterator_t *result = calloc(1, sizeof(list_iterator_t));
-  result->current = list->first;
-  result->list = list;
+  // Walk from the nearest link with a known position: the sentinel, the cursor
+  // if it can be reached, or the last link of a doubly linked list.
+  link_t *link = list->first;
+  size_t position = 0;
+  if (list->cursor_position <= index || (list->doubly && list->cursor_position - index < index))
+    {
+      link = list->cursor;
+      position = list->cursor_position;
+    }
+  size_t distance = position < index ? index - position : position - index;
+  if (list->doubly && list->size - index < distance)
+    {
+      link = list->last;
+      position = list->size;
+      distance = list->size - index;
+    }
+  if (list->skip != NULL && distance > LIST_CURSOR_WALK_LIMIT)
+    {
+      link = skip_index_link_at(list->skip, index);
+      position = index;
+    }
+  for (; position < index; ++position)
+    {
+      link = link->next;
+    }
+  for (; position > index; --position)
+    {
+      link = list_inner_link_preceding(list, link);
+    }
+  list->cursor = link;
+  list->cursor_position = index;
 
-  return result;
+  return link;
 }
 
-void iterator_insert(list_iterator_t *iter, const elem_t element)
+/**
+ * @brief Cut a non-empty list into runs of consecutive elements of about equal length.
+ * @param list The linked list.
+ * @param chunks The runs to fill in.
+ * @param count The number of runs, at most the number of elements.
+ * @return The number of runs filled in.
+ **/
+static size_t list_inner_split(list_t *list, list_chunk_t *chunks, const size_t count)
 {
-  link_t *link_to_insert = link_new(element, iter->current->next);
-  if (link_to_insert == NULL)
-  {
-    puts("Insertion failed due to memory corruption!");
-    return;
-  }
-  iter->current->next = link_to_insert;
+  if (list->engine)
+    {
+      return list->engine->split(list, chunks, count);
+    }
+  size_t start = 0;
+  for (size_t i = 0; i < count; ++i)
+    {
+      const size_t end = (i + 1) * list->size / count;
+      chunks[i] = (list_chunk_t) { .node = list_inner_link_before(list, start)->next, .length = end - start };
+      start = end;
+    }
+  return count;
 }
 
-bool iterator_has_next(list_iterator_t *iter)
+/**
+ * @brief Take the next element of a run.
+ * @param list The linked list the run belongs to.
+ * @param chunk The run.
+ * @return A pointer to the element, or NULL once the run is exhausted.
+ **/
+static elem_t *list_inner_chunk_next(list_t *list, list_chunk_t *chunk)
 {
-  return iter->current->next != NULL;
+  if (list->engine)
+    {
+      return list->engine->chunk_next(chunk);
+    }
+  if (chunk->length == 0)
+    {
+      return NULL;
+    }
+  link_t *link = chunk->node;
+  chunk->node = link->next;
+  chunk->length -= 1;
+  chunk->nodes += 1;
+  return &link->value;
 }
 
-elem_t iterator_next(list_iterator_t *iter)
+/**
+ * @brief Test or update the elements of one run of a parallel operation.
+ * @param arg The state of the operation.
+ * @param chunk The index of the run.
+ **/
+static void list_inner_parallel_chunk(void *arg, const size_t chunk)
 {
-  iter->current = iter->current->next;
-  return iter->current->value;
+  list_parallel_t *parallel = arg;
+  list_chunk_t *run = &parallel->chunks[chunk];
+  elem_t *value;
+  if (parallel->prop == NULL)
+    {
+      while ((value = list_inner_chunk_next(parallel->list, run)) != NULL)
+        {
+          parallel->fun(value, parallel->extra);
+        }
+      return;
+    }
+  size_t calls = 0;
+  while (!atomic_load_explicit(&parallel->found, memory_order_relaxed)
+         && (value = list_inner_chunk_next(parallel->list, run)) != NULL)
+    {
+      ++calls;
+      if (parallel->prop(*value, parallel->extra) == parallel->sought)
+        {
+          atomic_store_explicit(&parallel->found, true, memory_order_relaxed);
+        }
+    }
+  atomic_fetch_add_explicit(&parallel->calls, calls, memory_order_relaxed);
+  atomic_fetch_add_explicit(&parallel->nodes, run->nodes, memory_order_relaxed);
 }
 
-elem_t iterator_remove(list_iterator_t *iter)
+/**
+ * @brief Split a non-empty list into runs and process them on the threads of a pool.
+ * @param list The linked list.
+ * @param pool The threads, or NULL to process the runs on the calling thread.
+ * @param parallel The operation, whose remaining fields are filled in.
+ **/
+static void list_inner_parallel(list_t *list, thread_pool_t *pool, list_parallel_t *parallel)
 {
-  link_t *link_to_remove = iter->current->next;
-  const elem_t value_removed = link_to_remove->value;
-  iter->current->next = link_to_remove->next;
-  free(link_to_remove);
+  const size_t threads = pool ? thread_pool_threads(pool) : 1;
+  size_t count = threads * LIST_PARALLEL_CHUNKS_PER_THREAD;
+  count = count < list->size ? count : list->size;
+  list_chunk_t single;
+  list_chunk_t *chunks = threads > 1 ? malloc(count * sizeof(list_chunk_t)) : NULL;
+  if (chunks == NULL)
+    {
+      // Process the whole list as one run.
+      chunks = &single;
+      count = 1;
+    }
+  count = list_inner_split(list, chunks, count);
+  parallel->list = list;
+  parallel->chunks = chunks;
+  atomic_init(&parallel->found, false);
+  atomic_init(&parallel->calls, 0);
+  atomic_init(&parallel->nodes, 0);
 
-  return value_removed;
+  if (pool != NULL)
+    {
+      thread_pool_run(pool, list_inner_parallel_chunk, parallel, count);
+    }
+  else
+    {
+      list_inner_parallel_chunk(parallel, 0);
+    }
+  if (chunks != &single)
+    {
+      free(chunks);
+    }
+  if (parallel->prop != NULL)
+    {
+      LIST_COUNT(list, atomic_load(&parallel->calls), atomic_load(&parallel->nodes));
+    }
 }
 
-void iterator_reset(list_iterator_t *iter)
+/**
+ * @brief Cut a chain of links after a given number of links.
+ * @param head The first link of the chain, or NULL.
+ * @param count The number of links to keep, at least 1.
+ * @return The first link after the cut, or NULL if the chain was not longer than count.
+ **/
+static link_t *list_inner_cut(link_t *head, const size_t count)
 {
-  iter->current = iter->list->first;
+  for (size_t i = 1; head != NULL && i < count; ++i)
+    {
+      head = head->next;
+    }
+  if (head == NULL)
+    {
+      return NULL;
+    }
+  link_t *rest = head->next;
+  head->next = NULL;
+  return rest;
 }
 
-elem_t iterator_current(list_iterator_t *iter)
+/**
+ * @brief Merge two sorted chains of links, preferring the first chain on ties.
+ * @param cmp The comparison function that orders the elements.
+ * @param tail The link to attach the merged chain to.
+ * @param left The first sorted chain, which is not empty.
+ * @param right The second sorted chain, or NULL.
+ * @return The last link of the merged chain.
+ **/
+static link_t *list_inner_merge(cmp_function cmp, link_t *tail, link_t *left, link_t *right)
 {
-  if (!iterator_has_next(iter))
+  while (left != NULL && right != NULL)
     {
-      elem_t result = {.i = -1};
-      return result;
+      if (cmp(right->value, left->value) < 0)
+        {
+          tail->next = right;
+          right = right->next;
+        }
+      else
+        {
+          tail->next = left;
+          left = left->next;
+        }
+      tail = tail->next;
     }
-  return iter->current->next->value;
+  tail->next = left != NULL ? left : right;
+  while (tail->next != NULL)
+    {
+      tail = tail->next;
+    }
+  return tail;
 }
 
-void iterator_destroy(list_iterator_t *iter)
+/**
+ * @brief Check if two lists can exchange links, because they take them from the same place.
+ * @param list The first linked list.
+ * @param other The second linked list.
+ * @return True if a link of either list may be moved to the other, false otherwise.
+ **/
+static bool list_inner_shares_links(list_t *list, list_t *other)
 {
-  free(iter);
+  return !list->engine && !other->engine && list->doubly == other->doubly && list->pool == other->pool
+    && list->arena == other->arena;
 }
 
-list_t *linked_list_create(eq_function fun)
+/**
+ * @brief Get options that create an empty list like a given list.
+ * @param list The linked list.
+ * @param options The options to fill in.
+ **/
+static void list_inner_options(list_t *list, list_options_t *options)
 {
-  list_t *list = calloc(1, sizeof(list_t));
-  list->first = list->last = calloc(1, sizeof(link_t));
-  list->size = 0;
-  list->fun = fun;
-  
-  return list;
+  *options = (list_options_t) {
+    .fun = list->fun,
+    .layout = list->adaptive != NULL ? LIST_LAYOUT_ADAPTIVE
+      : list->engine == &unrolled_engine ? LIST_LAYOUT_UNROLLED
+      : list->engine == &array_engine ? LIST_LAYOUT_ARRAY
+      : list->engine == &compact_engine ? LIST_LAYOUT_COMPACT : LIST_LAYOUT_LINKED,
+    .pool = list->owns_pool ? NULL : list->pool,
+    .private_pool = list->owns_pool,
+    .hash = list->index != NULL ? hash_index_function(list->index) : NULL,
+    .skip_index = list->skip != NULL,
+    .doubly_linked = list->doubly,
+    .eq_kind = list->eq_kind,
+    .destructor = list->destructor,
+    .arena = list->arena,
+    .adaptive_to_array = list->adaptive != NULL ? list->adaptive->to_array : 0,
+    .adaptive_to_linked = list->adaptive != NULL ? list->adaptive->to_linked : 0,
+  };
 }
 
-void linked_list_destroy(list_t *list)
+/**
+ * @brief Move a chain of links from one list to another, or within a list.
+ *
+ * The lists must share their links. Both sizes, hash indices, skip indices,
+ * cursors, last links and previous links are kept up to date. A cursor that
+ * stays in front of the links moved keeps its place.
+ *
+ * @param list The list that the chain is moved to.
+ * @param before The link to attach the chain after, which is not part of the chain.
+ * @param source The list that the chain is moved from, which may be list.
+ * @param source_before The link preceding the chain in source.
+ * @param tail The last link of the chain.
+ * @param count The number of links in the chain.
+ **/
+static void list_inner_move_after(list_t *list, link_t *before, list_t *source, link_t *source_before,
+                                  link_t *tail, const size_t count)
 {
-  linked_list_clear(list);
-  free(list->first);
-  free(list);
-}
+  link_t *head = source_before->next;
+  source_before->next = tail->next;
+  if (tail == source->last)
+    {
+      source->last = source_before;
+    }
+  else
+    {
+      link_set_prev(source, tail->next, source_before);
+    }
+  source->size -= count;
+  if (list == source || source->cursor != source_before)
+    {
+      list_inner_cursor_reset(source);
+    }
+  if (source->skip != NULL)
+    {
+      skip_index_invalidate(source->skip);
+    }
 
-void linked_list_append(list_t *list, const elem_t value)
-{
-  link_t *link_to_append = link_new(value, NULL);
-  if (link_to_append == NULL)
-  {
-    puts("Append failed due to memory corruption!");
-    return;
-  }
-  list->last->next = link_to_append;
-  list->last = link_to_append;
-  list->size += 1;
-}
+  // The chain keeps its own previous links, so only its ends are relinked.
+  const bool at_end = before == list->last;
+  tail->next = before->next;
+  before->next = head;
+  link_set_prev(list, head, before);
+  if (at_end)
+    {
+      list->last = tail;
+    }
+  else
+    {
+      link_set_prev(list, tail->next, tail);
+    }
+  list->size += count;
+  if (list == source || (!at_end && list->cursor != before))
+    {
+      list_inner_cursor_reset(list);
+    }
+  if (list != source && (list->index != NULL || source->index != NULL))
+    {
+      for (link_t *cursor = head; cursor != tail->next; cursor = cursor->next)
+        {
+          list_inner_index_remove(source, cursor->value);
+          list_inner_index_add(list, cursor->value);
+        }
+    }
+  if (list->skip != NULL && at_end && list != source)
+    {
+      list_inner_skip_push_back(list, head);
+    }
+  else if (list->skip != NULL)
+    {
+      skip_index_invalidate(list->skip);
+    }
+}
+
+/**
+ * @brief Remove in one pass the elements for which a predicate returns a given result.
+ * @param list The linked list.
+ * @param prop The predicate.
+ * @param extra Additional argument passed to the predicate.
+ * @param matching The result of the predicate for the elements to remove.
+ * @return The number of elements removed.
+ **/
+static size_t list_inner_filter(list_t *list, predicate prop, const void *extra, const bool matching)
+{
+  if (list->engine)
+    {
+      const size_t removed = list->engine->filter(list, prop, extra, matching);
+      if (removed > 0)
+        {
+          list_inner_index_rebuild(list);
+        }
+      return removed;
+    }
+
+  // Relink the kept links past the removed ones, releasing each removed link while it is still in cache.
+  link_t *kept = list->first;
+  size_t removed = 0;
+  for (link_t *cursor = kept->next; cursor != NULL;)
+    {
+      link_t *next = cursor->next;
+      if (prop(cursor->value, extra) == matching)
+        {
+          list_inner_index_remove(list, cursor->value);
+          if (list->destructor != NULL)
+            {
+              list->destructor(cursor->value);
+            }
+          link_free(list, cursor);
+          ++removed;
+        }
+      else
+        {
+          if (kept->next != cursor)
+            {
+              kept->next = cursor;
+              link_set_prev(list, cursor, kept);
+            }
+          kept = cursor;
+        }
+      cursor = next;
+    }
+  if (removed == 0)
+    {
+      return 0;
+    }
+  kept->next = NULL;
+  list->last = kept;
+  list->size -= removed;
+  list_inner_cursor_reset(list);
+  if (list->skip != NULL)
+    {
+      skip_index_invalidate(list->skip);
+    }
+
+  return removed;
+}
+
+/**
+ * @brief Count an access to an adaptive list, and change its layout once the accesses call for it.
+ *
+ * Nothing is done for a list with a fixed layout. The accesses are weighed once
+ * there are at least one per LIST_ADAPTIVE_ELEMENTS_PER_ACCESS elements, so that
+ * the cost of a move is spread over the accesses that led to it, while a list
+ * in the wrong layout, where each access may take O(n) time, moves soon.
+ *
+ * @param list The linked list.
+ * @param positional True for an access by position away from both ends, false for an access at either end.
+ **/
+static void list_inner_adapt(list_t *list, const bool positional)
+{
+  list_adaptive_t *adaptive = list->adaptive;
+  if (adaptive == NULL)
+    {
+      return;
+    }
+  if (positional)
+    {
+      adaptive->stats.positional_ops += 1;
+    }
+  else
+    {
+      adaptive->stats.end_ops += 1;
+    }
+  const size_t accesses = adaptive->stats.positional_ops + adaptive->stats.end_ops;
+  if (accesses < LIST_ADAPTIVE_MIN_WINDOW || accesses < list->size / LIST_ADAPTIVE_ELEMENTS_PER_ACCESS)
+    {
+      return;
+    }
+  const size_t share = adaptive->stats.positional_ops * 100 / accesses;
+  adaptive->stats.decisions += 1;
+  adaptive->stats.positional_ops = 0;
+  adaptive->stats.end_ops = 0;
+  if (list->engine == NULL && share >= adaptive->to_array && list_inner_to_array(list))
+    {
+      adaptive->stats.to_array += 1;
+      adaptive->stats.elements_moved += list->size;
+    }
+  else if (list->engine != NULL && share <= adaptive->to_linked && list_inner_to_linked(list))
+    {
+      adaptive->stats.to_linked += 1;
+      adaptive->stats.elements_moved += list->size;
+    }
+}
+
+/**
+ * @brief Move the elements of a list from its links into the array engine.
+ * @param list The linked list, which must not have an engine.
+ * @return True on success, false if memory allocation failed, in which case the list is left unchanged.
+ **/
+static bool list_inner_to_array(list_t *list)
+{
+  link_t *sentinel = list->first;
+  const size_t size = list->size;
+  list->engine = &array_engine;
+  list->size = 0;
+  if (!list->engine->create(list))
+    {
+      list->engine = NULL;
+      list->size = size;
+      return false;
+    }
+  for (link_t *link = sentinel->next; link != NULL; link = link->next)
+    {
+      if (!list->engine->append(list, link->value))
+        {
+          // The elements still belong to the links, so they must not be destroyed with the array.
+          const free_function destructor = list->destructor;
+          list->destructor = NULL;
+          list->engine->destroy(list);
+          list->destructor = destructor;
+          list->engine = NULL;
+          list->store = NULL;
+          list->size = size;
+          return false;
+        }
+    }
+  while (sentinel != NULL)
+    {
+      link_t *next = sentinel->next;
+      link_free(list, sentinel);
+      sentinel = next;
+    }
+  list->first = list->last = list->cursor = NULL;
+  list->cursor_position = 0;
+
+  return true;
+}
+
+/**
+ * @brief Move the elements of a list from the array engine back into links.
+ * @param list The linked list, which must use the array engine.
+ * @return True on success, false if memory allocation failed, in which case the list is left unchanged.
+ **/
+static bool list_inner_to_linked(list_t *list)
+{
+  link_t *tail = NULL;
+  link_t *sentinel = link_chain_new(list, list->size + 1, &tail);
+  if (sentinel == NULL)
+    {
+      return false;
+    }
+  list_iterator_t iter = { .list = list };
+  list->engine->iterator_reset(&iter);
+  for (link_t *link = sentinel->next; link != NULL; link = link->next)
+    {
+      link->value = list->engine->iterator_next(&iter);
+    }
+  const size_t size = list->size;
+  // The elements now belong to the links, so they must not be destroyed with the array.
+  const free_function destructor = list->destructor;
+  list->destructor = NULL;
+  list->engine->destroy(list);
+  list->destructor = destructor;
+  list->engine = NULL;
+  list->store = NULL;
+  list->size = size;
+  list->first = sentinel;
+  list->last = tail;
+  list_inner_cursor_reset(list);
+
+  return true;
+}
+
+/**
+ * @brief Check that a mapped file holds a list written by linked_list_save on a machine of the same kind.
+ * @param header The start of the mapping.
+ * @param length The length of the mapping in bytes, at least the size of a header.
+ * @return True if the header is valid and the slots it describes lie within the mapping.
+ *         The links held in the slots are not checked.
+ **/
+static bool list_inner_file_valid(const list_file_header_t *header, const size_t length)
+{
+  if (memcmp(header->magic, LIST_FILE_MAGIC, sizeof(header->magic)) != 0
+      || header->version != LIST_FILE_VERSION
+      || header->byte_order != LIST_FILE_BYTE_ORDER
+      || header->elem_size != sizeof(elem_t)
+      || header->eq_kind > LIST_EQ_POINTER
+      || header->size >= UINT32_MAX
+      || header->last > header->size
+      || header->values % _Alignof(elem_t) != 0
+      || header->next % _Alignof(uint32_t) != 0
+      || header->values > length
+      || header->next > length)
+    {
+      return false;
+    }
+  // Both offsets are at most length and slots is below 2^32, so the sums cannot overflow.
+  const uint64_t slots = header->size + 1;
+  return header->values + slots * sizeof(elem_t) <= length && header->next + slots * sizeof(uint32_t) <= length;
+}
+
+/**
+ * @brief Write buffers to a file descriptor, retrying partial writes and interrupted calls.
+ * @param fd The file descriptor.
+ * @param iov The buffers, which are updated as they are written.
+ * @param count The number of buffers.
+ * @return True once all bytes are written, false if a write failed.
+ **/
+static bool list_inner_write_all(const int fd, struct iovec *iov, int count)
+{
+  while (count > 0)
+    {
+      const ssize_t written = writev(fd, iov, count);
+      if (written < 0 && errno == EINTR)
+        {
+          continue;
+        }
+      else if (written < 0)
+        {
+          return false;
+        }
+      size_t left = (size_t)written;
+      while (count > 0 && left >= iov->iov_len)
+        {
+          left -= iov->iov_len;
+          ++iov;
+          --count;
+        }
+      if (count > 0)
+        {
+          iov->iov_base = (char *)iov->iov_base + left;
+          iov->iov_len -= left;
+        }
+    }
+  return true;
+}
+
+/**
+ * @brief Read an exact number of bytes from a file descriptor, retrying short reads and interrupted calls.
+ * @param fd The file descriptor.
+ * @param buffer The buffer to read into.
+ * @param length The number of bytes to read.
+ * @return True once all bytes are read, false if a read failed or the stream ended first.
+ **/
+static bool list_inner_read_all(const int fd, void *buffer, size_t length)
+{
+  char *cursor = buffer;
+  while (length > 0)
+    {
+      const ssize_t got = read(fd, cursor, length);
+      if (got < 0 && errno == EINTR)
+        {
+          continue;
+        }
+      else if (got <= 0)
+        {
+          return false;
+        }
+      cursor += got;
+      length -= (size_t)got;
+    }
+  return true;
+}
+
+/**
+ * @brief Create a new link.
+ * @param list The list whose allocator the link is taken from.
+ * @param value Element value to set.
+ * @param next The next link.
+ * @return A pointer to the newly created link, or NULL if memory allocation failed.
+ **/
+static link_t *link_new(list_t *list, const elem_t value, link_t *next)
+{
+  link_t *new = NULL;
+  if (list->arena)
+    {
+      new = list->spare;
+      if (new != NULL)
+        {
+          list->spare = new->next;
+        }
+      else
+        {
+          new = arena_alloc(list->arena, link_size(list->doubly));
+        }
+    }
+  else
+    {
+      new = list->pool ? pool_alloc(list->pool) : calloc(1, link_size(list->doubly));
+    }
+  if (new == NULL)
+  {
+    puts("Failed to allocate memory for another link.");
+    return NULL;
+  }
+  new->value = value;
+  new->next = next;
+  link_set_prev(list, new, NULL);
+
+  return new;
+}
+
+/**
+ * @brief Release a link back to the allocator of a list.
+ * @param list The list whose allocator the link was taken from.
+ * @param link The link to release.
+ **/
+static void link_free(list_t *list, link_t *link)
+{
+  if (list->arena)
+    {
+      link->next = list->spare;
+      list->spare = link;
+    }
+  else if (list->pool)
+    {
+      pool_free(list->pool, link);
+    }
+  else
+    {
+      free(link);
+    }
+}
+
+/**
+ * @brief Create a chain of new links with undefined values.
+ * @param list The list whose allocator the links are taken from.
+ * @param count Number of links to create (must be greater than 0).
+ * @param tail Set to the last link of the chain, whose next link is NULL.
+ * @return The first link of the chain, or NULL if memory allocation failed.
+ **/
+static link_t *link_chain_new(list_t *list, const size_t count, link_t **tail)
+{
+  if (list->pool)
+    {
+      char *block = pool_alloc_many(list->pool, count);
+      if (block == NULL)
+        {
+          return NULL;
+        }
+      const size_t stride = pool_object_stride(list->pool);
+      for (size_t i = 0; i + 1 < count; ++i)
+        {
+          ((link_t *)(block + i * stride))->next = (link_t *)(block + (i + 1) * stride);
+        }
+      *tail = (link_t *)(block + (count - 1) * stride);
+      (*tail)->next = NULL;
+      return (link_t *)block;
+    }
+
+  link_t *head = NULL;
+  for (size_t i = 0; i < count; ++i)
+    {
+      link_t *new = link_new(list, (elem_t) { .i = 0 }, head);
+      if (new == NULL)
+        {
+          while (head != NULL)
+            {
+              link_t *next = head->next;
+              link_free(list, head);
+              head = next;
+            }
+          return NULL;
+        }
+      if (head == NULL)
+        {
+          *tail = new;
+        }
+      head = new;
+    }
+  return head;
+}
+
+/**
+ * @brief Get the size of the links of a list.
+ * @param doubly True for a doubly linked list.
+ * @return The size in bytes of a link.
+ **/
+static size_t link_size(const bool doubly)
+{
+  return doubly ? sizeof(doubly_link_t) : sizeof(link_t);
+}
+
+/**
+ * @brief Move the cursor of a list back to the sentinel.
+ *
+ * This must be done whenever links may have been removed or moved without
+ * the cursor being updated.
+ *
+ * @param list The linked list.
+ **/
+static void list_inner_cursor_reset(list_t *list)
+{
+  list->cursor = list->first;
+  list->cursor_position = 0;
+}
+
+/**
+ * @brief Set the previous link of a link, if the list is doubly linked.
+ * @param list The list the link belongs to.
+ * @param link The link to update.
+ * @param prev The new previous link.
+ **/
+static void link_set_prev(list_t *list, link_t *link, link_t *prev)
+{
+  if (list->doubly)
+    {
+      ((doubly_link_t *)link)->prev = prev;
+    }
+}
+
+/**
+ * @brief Find the link preceding a given link.
+ * @param list The linked list.
+ * @param link A link of the list other than the sentinel.
+ * @return The preceding link, found in O(1) time for a doubly linked list and O(n) time otherwise.
+ **/
+static link_t *list_inner_link_preceding(list_t *list, link_t *link)
+{
+  if (list->doubly)
+    {
+      return ((doubly_link_t *)link)->prev;
+    }
+  link_t *cursor = list->first;
+  while (cursor->next != link)
+    {
+      cursor = cursor->next;
+    }
+
+  return cursor;
+}
+
+/**
+ * @brief Attach a chain of links after a given link of a list.
+ *
+ * The last link and the previous links are kept up to date, while the size and
+ * the indices of the list are left to the caller.
+ *
+ * @param list The linked list.
+ * @param before The link to attach the chain after.
+ * @param head The first link of the chain.
+ * @param tail The last link of the chain.
+ **/
+static void list_inner_link_after(list_t *list, link_t *before, link_t *head, link_t *tail)
+{
+  tail->next = before->next;
+  before->next = head;
+  if (before == list->last)
+    {
+      list->last = tail;
+    }
+  if (!list->doubly)
+    {
+      return;
+    }
+  for (link_t *cursor = head, *prev = before; prev != tail; prev = cursor, cursor = cursor->next)
+    {
+      link_set_prev(list, cursor, prev);
+    }
+  if (tail->next != NULL)
+    {
+      link_set_prev(list, tail->next, tail);
+    }
+}
+
+/**
+ * @brief Detach the link following a given link of a list.
+ *
+ * The last link and the previous links are kept up to date, while the size and
+ * the indices of the list are left to the caller.
+ *
+ * @param list The linked list.
+ * @param before The link preceding the link to detach, which must exist.
+ * @return The detached link.
+ **/
+static link_t *list_inner_unlink_after(list_t *list, link_t *before)
+{
+  link_t *link = before->next;
+  before->next = link->next;
+  if (link == list->last)
+    {
+      list->last = before;
+    }
+  else
+    {
+      link_set_prev(list, link->next, before);
+    }
+
+  return link;
+}
+
+/**
+ * @brief Record an element added to a list in its hash index, if it has one.
+ * @param list The linked list.
+ * @param value The element added.
+ **/
+static void list_inner_index_add(list_t *list, const elem_t value)
+{
+  if (list->index != NULL && !hash_index_add(list->index, value))
+    {
+      puts("Hash index disabled due to memory corruption!");
+      hash_index_destroy(list->index);
+      list->index = NULL;
+    }
+}
+
+/**
+ * @brief Forget an element removed from a list in its hash index, if it has one.
+ * @param list The linked list.
+ * @param value The element removed.
+ **/
+static void list_inner_index_remove(list_t *list, const elem_t value)
+{
+  if (list->index != NULL)
+    {
+      hash_index_remove(list->index, value);
+    }
+}
+
+/**
+ * @brief Rebuild the hash index of a list from its elements, if it has one.
+ * @param list The linked list.
+ **/
+static void list_inner_index_rebuild(list_t *list)
+{
+  if (list->index == NULL)
+    {
+      return;
+    }
+  hash_index_clear(list->index);
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  while (list->index != NULL && iterator_has_next(iter))
+    {
+      list_inner_index_add(list, iterator_next(iter));
+    }
+}
+
+/**
+ * @brief Record links just attached to the end of a list in its skip index, if it has one.
+ * @param list The linked list, whose size already counts the new links.
+ * @param head The first of the new links, which run to the end of the list.
+ **/
+static void list_inner_skip_push_back(list_t *list, link_t *head)
+{
+  if (list->skip == NULL)
+    {
+      return;
+    }
+  size_t position = list->size;
+  for (link_t *cursor = head->next; cursor; cursor = cursor->next)
+    {
+      --position;
+    }
+  for (link_t *cursor = head; cursor; cursor = cursor->next, ++position)
+    {
+      skip_index_insert(list->skip, cursor, position, position);
+    }
+}
+
+list_iterator_t *list_iterator(list_t *list)
+{
+  list_iterator_t *result = list->arena ? arena_alloc(list->arena, sizeof(list_iterator_t))
+                                         : calloc(1, sizeof(list_iterator_t));
+  return list_iterator_init((list_iterator_storage_t *)result, list);
+}
+
+list_iterator_t *list_iterator_init(list_iterator_storage_t *storage, list_t *list)
+{
+  _Static_assert(sizeof(list_iterator_t) <= sizeof(list_iterator_storage_t),
+                 "list_iterator_storage_t is too small to hold an iterator");
+  list_iterator_t *result = (list_iterator_t *)storage;
+  result->current = list->first;
+  result->list = list;
+  result->node = NULL;
+  result->offset = 0;
+  if (list->engine)
+    {
+      list->engine->iterator_reset(result);
+    }
+
+  return result;
+}
+
+void iterator_insert(list_iterator_t *iter, const elem_t element)
+{
+  if (iter->list->engine)
+    {
+      if (iter->list->engine->iterator_insert(iter, element))
+        {
+          list_inner_index_add(iter->list, element);
+        }
+      return;
+    }
+  link_t *link_to_insert = link_new(iter->list, element, NULL);
+  if (link_to_insert == NULL)
+  {
+    puts("Insertion failed due to memory corruption!");
+    return;
+  }
+  list_inner_link_after(iter->list, iter->current, link_to_insert, link_to_insert);
+  iter->list->size += 1;
+  list_inner_cursor_reset(iter->list);
+  list_inner_index_add(iter->list, element);
+  if (iter->list->skip != NULL)
+    {
+      skip_index_invalidate(iter->list->skip);
+    }
+}
+
+void iterator_splice(list_iterator_t *iter, list_iterator_t *source, const size_t count)
+{
+  if (iter->list == source->list && (iter->list->engine || iter == source))
+    {
+      puts("Splicing within a list needs the linked layout and two iterators!");
+      return;
+    }
+  else if (!list_inner_shares_links(iter->list, source->list))
+    {
+      for (size_t i = 0; i < count && iterator_has_next(source); ++i)
+        {
+          const size_t size = linked_list_size(iter->list);
+          const elem_t value = iterator_current(source);
+          iterator_insert(iter, value);
+          if (linked_list_size(iter->list) == size)
+            {
+              return;
+            }
+          iterator_remove(source);
+          iterator_next(iter);
+        }
+      return;
+    }
+  size_t moved = 0;
+  link_t *tail = source->current;
+  for (; moved < count && tail->next != NULL; ++moved)
+    {
+      tail = tail->next;
+      if (tail == iter->current)
+        {
+          puts("Cannot splice elements after themselves!");
+          return;
+        }
+    }
+  if (moved == 0)
+    {
+      return;
+    }
+  list_inner_move_after(iter->list, iter->current, source->list, source->current, tail, moved);
+  iter->current = tail;
+}
+
+bool iterator_has_next(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      return iter->list->engine->iterator_has_next(iter);
+    }
+  return iter->current->next != NULL;
+}
+
+elem_t iterator_next(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      return iter->list->engine->iterator_next(iter);
+    }
+  iter->current = iter->current->next;
+  return iter->current->value;
+}
+
+bool iterator_has_previous(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      return iter->list->engine->iterator_has_previous(iter);
+    }
+  return iter->current != iter->list->first;
+}
+
+elem_t iterator_previous(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      return iter->list->engine->iterator_previous(iter);
+    }
+  if (!iterator_has_previous(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  const elem_t value = iter->current->value;
+  iter->current = list_inner_link_preceding(iter->list, iter->current);
+  return value;
+}
+
+elem_t iterator_remove(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      const bool removable = iter->list->engine->iterator_has_next(iter);
+      const elem_t value_removed = iter->list->engine->iterator_remove(iter);
+      if (removable)
+        {
+          list_inner_index_remove(iter->list, value_removed);
+        }
+      return value_removed;
+    }
+  link_t *link_to_remove = list_inner_unlink_after(iter->list, iter->current);
+  const elem_t value_removed = link_to_remove->value;
+  link_free(iter->list, link_to_remove);
+  iter->list->size -= 1;
+  list_inner_cursor_reset(iter->list);
+  list_inner_index_remove(iter->list, value_removed);
+  if (iter->list->skip != NULL)
+    {
+      skip_index_invalidate(iter->list->skip);
+    }
+
+  return value_removed;
+}
+
+void iterator_reset(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      iter->list->engine->iterator_reset(iter);
+      return;
+    }
+  iter->current = iter->list->first;
+}
+
+void iterator_to_end(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      iter->list->engine->iterator_to_end(iter);
+      return;
+    }
+  iter->current = iter->list->last;
+}
+
+elem_t iterator_current(list_iterator_t *iter)
+{
+  if (iter->list->engine)
+    {
+      return iter->list->engine->iterator_current(iter);
+    }
+  if (!iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  return iter->current->next->value;
+}
+
+void iterator_destroy(list_iterator_t *iter)
+{
+  if (iter->list->arena == NULL)
+    {
+      free(iter);
+    }
+}
+
+list_t *linked_list_create(eq_function fun)
+{
+  const list_options_t options = { .fun = fun };
+  return linked_list_create_with(&options);
+}
+
+pool_t *linked_list_pool_create(const size_t links_per_slab)
+{
+  return pool_create(sizeof(link_t), links_per_slab);
+}
+
+list_t *linked_list_create_pooled(eq_function fun, pool_t *pool)
+{
+  const list_options_t options = { .fun = fun, .pool = pool, .private_pool = pool == NULL };
+  return linked_list_create_with(&options);
+}
+
+list_t *linked_list_create_in_arena(arena_t *arena, eq_function fun)
+{
+  const list_options_t options = { .fun = fun, .arena = arena };
+  return linked_list_create_with(&options);
+}
+
+list_t *linked_list_create_with(const list_options_t *options)
+{
+  const bool pooled = options->pool != NULL || options->private_pool;
+  if (options->layout != LIST_LAYOUT_LINKED && pooled)
+    {
+      puts("Pools can only be used with the linked layout!");
+      return NULL;
+    }
+  if (options->pool != NULL && pool_object_size(options->pool) < link_size(options->doubly_linked))
+    {
+      puts("Pool objects are too small to hold links!");
+      return NULL;
+    }
+  if (options->layout != LIST_LAYOUT_LINKED && options->skip_index)
+    {
+      puts("Skip indices can only be used with the linked layout!");
+      return NULL;
+    }
+  if (options->layout != LIST_LAYOUT_LINKED && options->doubly_linked)
+    {
+      puts("Doubly linked lists must use the linked layout!");
+      return NULL;
+    }
+  if (options->arena != NULL && (options->layout != LIST_LAYOUT_LINKED || pooled))
+    {
+      puts("Arenas can only be used with the linked layout and without a pool!");
+      return NULL;
+    }
+  if (options->arena != NULL && (options->hash != NULL || options->skip_index))
+    {
+      puts("Lists in an arena cannot have a hash index or a skip index!");
+      return NULL;
+    }
+  const unsigned to_array = options->adaptive_to_array ? options->adaptive_to_array : 50;
+  const unsigned to_linked = options->adaptive_to_linked ? options->adaptive_to_linked : 10;
+  if (options->layout == LIST_LAYOUT_ADAPTIVE && (to_array > 100 || to_linked >= to_array))
+    {
+      puts("Adaptive lists must move to the array layout at a higher share than back!");
+      return NULL;
+    }
+  list_t *list = options->arena ? arena_alloc(options->arena, sizeof(list_t)) : calloc(1, sizeof(list_t));
+  if (list == NULL)
+    {
+      puts("Failed to allocate memory for a list.");
+      return NULL;
+    }
+  *list = (list_t) { .arena = options->arena };
+  list->size = 0;
+  list->eq_kind = options->eq_kind;
+  list->fun = options->eq_kind == LIST_EQ_CUSTOM ? options->fun : list_inner_eq_function(options->eq_kind);
+  list->destructor = options->destructor;
+  if (options->layout == LIST_LAYOUT_UNROLLED || options->layout == LIST_LAYOUT_ARRAY
+      || options->layout == LIST_LAYOUT_COMPACT)
+    {
+      list->engine = options->layout == LIST_LAYOUT_ARRAY ? &array_engine
+        : options->layout == LIST_LAYOUT_COMPACT ? &compact_engine : &unrolled_engine;
+      if (!list->engine->create(list))
+        {
+          free(list);
+          return NULL;
+        }
+    }
+  else
+    {
+      list->doubly = options->doubly_linked;
+      list->owns_pool = options->pool == NULL && options->private_pool;
+      list->pool = list->owns_pool ? pool_create(link_size(list->doubly), 0) : options->pool;
+      // The sentinel of a list with a private pool lives outside the pool, so that clearing can reset the pool.
+      if (list->owns_pool && list->pool == NULL)
+        {
+          list->first = NULL;
+        }
+      else
+        {
+          list->first = list->owns_pool ? calloc(1, link_size(list->doubly))
+                                        : link_new(list, (elem_t) { .i = 0 }, NULL);
+        }
+      if (list->first == NULL)
+        {
+          puts("Failed to allocate memory for a list.");
+          if (list->owns_pool && list->pool != NULL)
+            {
+              pool_destroy(list->pool);
+            }
+          if (list->arena == NULL)
+            {
+              free(list);
+            }
+          return NULL;
+        }
+      list->last = list->first;
+      list_inner_cursor_reset(list);
+    }
+
+  if (options->layout == LIST_LAYOUT_ADAPTIVE)
+    {
+      list->adaptive = calloc(1, sizeof(list_adaptive_t));
+      if (list->adaptive == NULL)
+        {
+          linked_list_destroy(list);
+          return NULL;
+        }
+      list->adaptive->to_array = to_array;
+      list->adaptive->to_linked = to_linked;
+    }
+  if (options->hash != NULL)
+    {
+      list->index = hash_index_create(options->hash, list->fun);
+      if (list->index == NULL)
+        {
+          linked_list_destroy(list);
+          return NULL;
+        }
+    }
+  if (options->skip_index)
+    {
+      list->skip = skip_index_create(list->first);
+      if (list->skip == NULL)
+        {
+          linked_list_destroy(list);
+          return NULL;
+        }
+    }
+
+  return list;
+}
+
+void linked_list_destroy(list_t *list)
+{
+  if (list->arena)
+    {
+      // Everything lives in the arena, so only the elements need attention.
+      if (list->destructor != NULL)
+        {
+          linked_list_clear(list);
+        }
+      return;
+    }
+  if (list->index != NULL)
+    {
+      hash_index_destroy(list->index);
+      list->index = NULL;
+    }
+  if (list->skip != NULL)
+    {
+      skip_index_destroy(list->skip);
+      list->skip = NULL;
+    }
+  free(list->adaptive);
+  if (list->engine)
+    {
+      list->engine->destroy(list);
+      free(list);
+      return;
+    }
+  linked_list_clear(list);
+  if (list->owns_pool)
+    {
+      pool_destroy(list->pool);
+      free(list->first);
+    }
+  else
+    {
+      link_free(list, list->first);
+    }
+  free(list);
+}
+
+void linked_list_append(list_t *list, const elem_t value)
+{
+  list_inner_adapt(list, false);
+  if (list->engine)
+    {
+      if (list->engine->append(list, value))
+        {
+          list_inner_index_add(list, value);
+        }
+      return;
+    }
+  link_t *link_to_append = link_new(list, value, NULL);
+  if (link_to_append == NULL)
+  {
+    puts("Append failed due to memory corruption!");
+    return;
+  }
+  list_inner_link_after(list, list->last, link_to_append, link_to_append);
+  list->size += 1;
+  list_inner_index_add(list, value);
+  if (list->skip != NULL)
+    {
+      skip_index_insert(list->skip, link_to_append, list->size, list->size);
+    }
+}
+
+void linked_list_prepend(list_t *list, const elem_t value)
+{
+  list_inner_adapt(list, false);
+  if (list->engine)
+    {
+      if (list->engine->prepend(list, value))
+        {
+          list_inner_index_add(list, value);
+        }
+      return;
+    }
+  link_t *link_to_prepend = link_new(list, value, NULL);
+  if (link_to_prepend == NULL)
+  {
+    puts("Prepend failed due to memory corruption!");
+    return;
+  }
+  list_inner_link_after(list, list->first, link_to_prepend, link_to_prepend);
+  list->size += 1;
+  if (list->cursor_position > 0)
+    {
+      list->cursor_position += 1;
+    }
+  list_inner_index_add(list, value);
+  if (list->skip != NULL)
+    {
+      skip_index_insert(list->skip, link_to_prepend, 1, list->size);
+    }
+}
+
+void linked_list_append_array(list_t *list, const elem_t *values, const size_t count)
+{
+  if (count == 0)
+    {
+      return;
+    }
+  else if (list->engine)
+    {
+      for (size_t i = 0; i < count; ++i)
+        {
+          if (list->engine->append(list, values[i]))
+            {
+              list_inner_index_add(list, values[i]);
+            }
+        }
+      return;
+    }
+  link_t *tail = NULL;
+  link_t *head = link_chain_new(list, count, &tail);
+  if (head == NULL)
+    {
+      puts("Append failed due to memory corruption!");
+      return;
+    }
+  size_t i = 0;
+  for (link_t *cursor = head; cursor; cursor = cursor->next)
+    {
+      cursor->value = values[i++];
+      list_inner_index_add(list, cursor->value);
+    }
+  list_inner_link_after(list, list->last, head, tail);
+  list->size += count;
+  list_inner_skip_push_back(list, head);
+}
+
+void linked_list_prepend_array(list_t *list, const elem_t *values, const size_t count)
+{
+  if (count == 0)
+    {
+      return;
+    }
+  else if (list->engine)
+    {
+      for (size_t i = count; i > 0; --i)
+        {
+          if (list->engine->prepend(list, values[i - 1]))
+            {
+              list_inner_index_add(list, values[i - 1]);
+            }
+        }
+      return;
+    }
+  link_t *tail = NULL;
+  link_t *head = link_chain_new(list, count, &tail);
+  if (head == NULL)
+    {
+      puts("Prepend failed due to memory corruption!");
+      return;
+    }
+  size_t i = 0;
+  for (link_t *cursor = head; cursor; cursor = cursor->next)
+    {
+      cursor->value = values[i++];
+      list_inner_index_add(list, cursor->value);
+    }
+  list_inner_link_after(list, list->first, head, tail);
+  list->size += count;
+  if (list->cursor_position > 0)
+    {
+      list->cursor_position += count;
+    }
+  if (list->skip != NULL)
+    {
+      skip_index_invalidate(list->skip);
+    }
+}
+
+void linked_list_extend(list_t *list, list_t *other)
+{
+  const size_t count = linked_list_size(other);
+  if (count == 0)
+    {
+      return;
+    }
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, other);
+  if (list->engine)
+    {
+      for (size_t i = 0; i < count; ++i)
+        {
+          const elem_t value = iterator_next(iter);
+          if (list->engine->append(list, value))
+            {
+              list_inner_index_add(list, value);
+            }
+        }
+      return;
+    }
+  link_t *tail = NULL;
+  link_t *head = link_chain_new(list, count, &tail);
+  if (head == NULL)
+    {
+      puts("Extend failed due to memory corruption!");
+      return;
+    }
+  for (link_t *cursor = head; cursor; cursor = cursor->next)
+    {
+      cursor->value = iterator_next(iter);
+      list_inner_index_add(list, cursor->value);
+    }
+  list_inner_link_after(list, list->last, head, tail);
+  list->size += count;
+  list_inner_skip_push_back(list, head);
+}
+
+void linked_list_concat(list_t *list, list_t *other)
+{
+  if (list == other)
+    {
+      puts("Cannot concatenate a list with itself!");
+      return;
+    }
+  const size_t count = linked_list_size(other);
+  if (count == 0)
+    {
+      return;
+    }
+  else if (!list_inner_shares_links(list, other))
+    {
+      const size_t size = linked_list_size(list);
+      linked_list_extend(list, other);
+      if (linked_list_size(list) == size + count)
+        {
+          // The elements now belong to list, so they must not be destroyed with other.
+          const free_function destructor = other->destructor;
+          other->destructor = NULL;
+          linked_list_clear(other);
+          other->destructor = destructor;
+        }
+      return;
+    }
+  list_inner_move_after(list, list->last, other, other->first, other->last, count);
+}
+
+list_t *linked_list_split_at(list_t *list, const int index)
+{
+  const size_t size = linked_list_size(list);
+  const int adjusted_index = list_inner_adjust_index(index, size);
+  const size_t valid_index = (size_t)adjusted_index;
+  if (adjusted_index == -1)
+    {
+      printf("%d is not a valid index!\n", index);
+      return NULL;
+    }
+  list_options_t options;
+  list_inner_options(list, &options);
+  list_t *result = linked_list_create_with(&options);
+  if (result == NULL || valid_index == size)
+    {
+      return result;
+    }
+  else if (list_inner_shares_links(result, list))
+    {
+      link_t *before = list_inner_link_before(list, valid_index);
+      list_inner_move_after(result, result->first, list, before, list->last, size - valid_index);
+      return result;
+    }
 
-void linked_list_prepend(list_t *list, const elem_t value)
-{
-  link_t *link_to_prepend = link_new(value, list->first->next);
-  if (link_to_prepend == NULL)
-  {
-    puts("Prepend failed due to memory corruption!");
-    return;
-  }
-  if (list->first == list->last)
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  for (size_t i = 0; i < valid_index; ++i)
     {
-      list->last = link_to_prepend;
+      iterator_next(iter);
     }
-  
-  list->first->next = link_to_prepend;
-  list->size += 1;
+  list_iterator_storage_t result_storage;
+  list_iterator_t *result_iter = list_iterator_init(&result_storage, result);
+  iterator_splice(result_iter, iter, size - valid_index);
+
+  return result;
 }
 
 void linked_list_insert(list_t *list, const int index, const elem_t value)
@@ -222,6 +2012,23 @@ void linked_list_insert(list_t *list, const int index, const elem_t value)
       printf("%d is not a valid index!\n", index);
       return;
     }
+  else if (valid_index != 0 && valid_index != size)
+    {
+      list_inner_adapt(list, true);
+    }
+  if (list->engine)
+    {
+      if (list->engine->insert(list, valid_index, value))
+        {
+          list_inner_index_add(list, value);
+        }
+      if (valid_index == 0 || valid_index == size)
+        {
+          // Counted here rather than before, since the linked layout counts it in prepend or append.
+          list_inner_adapt(list, false);
+        }
+      return;
+    }
   else if (valid_index == 0)
   {
     linked_list_prepend(list, value);
@@ -234,42 +2041,143 @@ void linked_list_insert(list_t *list, const int index, const elem_t value)
   }
   else
   {
-    list_iterator_t *iter = list_iterator(list);
-    
-    for (size_t i = 0; i < valid_index; ++i)
+    link_t *before = list_inner_link_before(list, valid_index);
+    link_t *link_to_insert = link_new(list, value, NULL);
+    if (link_to_insert == NULL)
       {
-        iterator_next(iter);
+        puts("Insertion failed due to memory corruption!");
+        return;
       }
-    
-    iterator_insert(iter, value);
+    list_inner_link_after(list, before, link_to_insert, link_to_insert);
     list->size += 1;
-    iterator_destroy(iter);
+    list_inner_index_add(list, value);
+    if (list->skip != NULL)
+      {
+        skip_index_insert(list->skip, link_to_insert, valid_index + 1, list->size);
+      }
   }
 }
 
+void linked_list_insert_sorted(list_t *list, cmp_function cmp, const elem_t value)
+{
+  if (list->size == 0 || cmp(linked_list_get(list, (int)list->size - 1), value) <= 0)
+    {
+      linked_list_append(list, value);
+      return;
+    }
+  if (list->engine)
+    {
+      list_iterator_storage_t storage;
+      list_iterator_t *iter = list_iterator_init(&storage, list);
+      size_t position = 0;
+      while (cmp(iterator_next(iter), value) <= 0)
+        {
+          ++position;
+        }
+      if (list->engine->insert(list, position, value))
+        {
+          list_inner_index_add(list, value);
+        }
+      return;
+    }
+  // The last element is ordered after the value, so the walk stops before it.
+  link_t *before = list->first;
+  size_t position = 0;
+  while (cmp(before->next->value, value) <= 0)
+    {
+      before = before->next;
+      ++position;
+    }
+  link_t *link_to_insert = link_new(list, value, NULL);
+  if (link_to_insert == NULL)
+    {
+      puts("Insertion failed due to memory corruption!");
+      return;
+    }
+  list_inner_link_after(list, before, link_to_insert, link_to_insert);
+  list->size += 1;
+  list->cursor = before;
+  list->cursor_position = position;
+  list_inner_index_add(list, value);
+  if (list->skip != NULL)
+    {
+      skip_index_insert(list->skip, link_to_insert, position + 1, list->size);
+    }
+}
+
+void linked_list_sort(list_t *list, cmp_function cmp)
+{
+  if (list->engine)
+    {
+      if (!list->engine->sort(list, cmp))
+        {
+          puts("Sorting failed due to memory corruption!");
+        }
+      return;
+    }
+  if (list->size < 2)
+    {
+      return;
+    }
+  // Merge runs of width links pairwise, doubling the width on every pass.
+  link_t *tail = list->first;
+  for (size_t width = 1; width < list->size; width *= 2)
+    {
+      link_t *rest = list->first->next;
+      tail = list->first;
+      while (rest != NULL)
+        {
+          link_t *left = rest;
+          link_t *right = list_inner_cut(left, width);
+          rest = list_inner_cut(right, width);
+          tail = list_inner_merge(cmp, tail, left, right);
+        }
+    }
+  list->last = tail;
+  if (list->doubly)
+    {
+      for (link_t *link = list->first; link->next != NULL; link = link->next)
+        {
+          link_set_prev(list, link->next, link);
+        }
+    }
+  list_inner_cursor_reset(list);
+  if (list->skip != NULL)
+    {
+      skip_index_invalidate(list->skip);
+    }
+}
+
 elem_t linked_list_remove(list_t *list, const int index)
 {
   const int size = linked_list_size(list);
   const int upper_limit = size - 1;
   const int adjusted_index = list_inner_adjust_index(index, upper_limit);
   const size_t valid_index = (size_t)adjusted_index;
-  if (adjusted_index == -1)
+  if (adjusted_index == -1 || size == 0)
   {
     elem_t result = {.i = -1};
     return result;
   }
-    
-  list_iterator_t *iter = list_iterator(list);
+  list_inner_adapt(list, valid_index != 0 && adjusted_index != upper_limit);
+  if (list->engine)
+  {
+    const elem_t value_removed = list->engine->remove(list, valid_index);
+    list_inner_index_remove(list, value_removed);
+    return value_removed;
+  }
 
-  for (size_t i = 0; i < valid_index; ++i)
+  link_t *before = list_inner_link_before(list, valid_index);
+  link_t *link_to_remove = list_inner_unlink_after(list, before);
+  const elem_t value_removed = link_to_remove->value;
+  link_free(list, link_to_remove);
+  list->size -= 1;
+  list_inner_index_remove(list, value_removed);
+  if (list->skip != NULL)
     {
-      iterator_next(iter);
+      skip_index_remove(list->skip, valid_index + 1);
     }
 
-  const elem_t value_removed = iterator_remove(iter);
-  list->size -= 1;
-  iterator_destroy(iter);
-
   return value_removed;
 }
 
@@ -280,41 +2188,68 @@ elem_t linked_list_get(list_t *list, const int index)
   const int adjusted_index = list_inner_adjust_index(index, upper_limit);
   const size_t valid_index = (size_t)adjusted_index;
   
-  if (adjusted_index == -1)
+  if (adjusted_index == -1 || size == 0)
   {
     elem_t result = {.i = -1};
     return result;
   }
-  list_iterator_t *iter = list_iterator(list);
-  
-  for (size_t i = 0; i < valid_index; ++i)
-    {
-      iterator_next(iter);
-    }
+  list_inner_adapt(list, valid_index != 0 && adjusted_index != upper_limit);
+  if (list->engine)
+  {
+    return list->engine->get(list, valid_index);
+  }
+
+  else if (valid_index + 1 == (size_t)size)
+  {
+    return list->last->value;
+  }
 
-  elem_t value = iterator_current(iter);
-  iterator_destroy(iter);
+  return list_inner_link_before(list, valid_index)->next->value;
+}
 
-  return value;
-  
+elem_t linked_list_pop_front(list_t *list)
+{
+  return linked_list_remove(list, 0);
+}
+
+elem_t linked_list_pop_back(list_t *list)
+{
+  const size_t size = linked_list_size(list);
+  if (size == 0)
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  return linked_list_remove(list, (int)size - 1);
 }
 
 bool linked_list_contains(list_t *list, const elem_t element)
 {
-  bool result = false;
-  list_iterator_t *iter = list_iterator(list);
-  
-  while (iterator_has_next(iter))
+  if (list->index != NULL)
+    {
+      return hash_index_contains(list->index, element);
+    }
+  else if (list->engine)
+    {
+      return list->engine->contains(list, element);
+    }
+  switch (list->eq_kind)
+    {
+    case LIST_EQ_INT: LIST_SCAN(list, element, i);
+    case LIST_EQ_UNSIGNED: LIST_SCAN(list, element, u);
+    case LIST_EQ_BOOL: LIST_SCAN(list, element, b);
+    case LIST_EQ_FLOAT: LIST_SCAN(list, element, f);
+    case LIST_EQ_POINTER: LIST_SCAN(list, element, p);
+    case LIST_EQ_CUSTOM: break;
+    }
+  for (const link_t *cursor = list->first->next; cursor; cursor = cursor->next)
     {
-      elem_t current_value = iterator_next(iter);
-      if (list->fun(current_value, element))
+      if (list->fun(cursor->value, element))
         {
-          result = true;
-          break;
+          return true;
         }
     }
-  iterator_destroy(iter);
-  return result;
+  return false;
 }
 
 size_t linked_list_size(list_t *list)
@@ -325,15 +2260,22 @@ size_t linked_list_size(list_t *list)
 size_t linked_list_calculate_size(list_t *list)
 {
   size_t size = 0;
-  list_iterator_t *iter = list_iterator(list);
+  if (list->engine)
+    {
+      list_iterator_storage_t storage;
+      list_iterator_t *iter = list_iterator_init(&storage, list);
+      while (iterator_has_next(iter))
+        {
+          iterator_next(iter);
+          ++size;
+        }
+      return size;
+    }
 
-  while (iterator_has_next(iter))
+  for (const link_t *cursor = list->first->next; cursor; cursor = cursor->next)
     {
-      iterator_next(iter);
       ++size;
     }
-  
-  iterator_destroy(iter);
   return size;
 }
 
@@ -347,53 +2289,376 @@ bool linked_list_is_empty(list_t *list)
   return false;
 }
 
+size_t linked_list_remove_if(list_t *list, predicate prop, const void *extra)
+{
+  return list_inner_filter(list, prop, extra, true);
+}
+
+size_t linked_list_retain_if(list_t *list, predicate prop, const void *extra)
+{
+  return list_inner_filter(list, prop, extra, false);
+}
+
 void linked_list_clear(list_t *list)
 {
-  if (!linked_list_is_empty(list))
+  if (list->index != NULL)
     {
-      list_iterator_t *iter = list_iterator(list);
-      while (iterator_has_next(iter))
+      hash_index_clear(list->index);
+    }
+  if (list->engine)
+    {
+      list->engine->clear(list);
+      return;
+    }
+  if (list->owns_pool)
+    {
+      for (const link_t *cursor = list->first->next; cursor && list->destructor; cursor = cursor->next)
+        {
+          list->destructor(cursor->value);
+        }
+      pool_reset(list->pool);
+    }
+  else if (list->arena && list->destructor == NULL)
+    {
+      list->last->next = list->spare;
+      list->spare = list->first->next;
+    }
+  else
+    {
+      link_t *cursor = list->first->next;
+      while (cursor != NULL)
         {
-          iterator_remove(iter);
-          iterator_reset(iter);
-          list->size -= 1;
+          link_t *next = cursor->next;
+          if (list->destructor != NULL)
+            {
+              list->destructor(cursor->value);
+            }
+          link_free(list, cursor);
+          cursor = next;
         }
-      iterator_destroy(iter);
+    }
+  list->first->next = NULL;
+  list->last = list->first;
+  list->size = 0;
+  list_inner_cursor_reset(list);
+  if (list->skip != NULL)
+    {
+      skip_index_clear(list->skip);
     }
 }
 
 bool linked_list_all(list_t *list, predicate prop, const void *extra)
 {
-  bool result = true;
-  list_iterator_t *iter = list_iterator(list);
-  while (iterator_has_next(iter))
+  if (list->engine)
     {
-      result = result && prop(iterator_current(iter), extra);
-      iterator_next(iter);
+      return list->engine->all(list, prop, extra);
+    }
+  size_t visited = 0;
+  for (const link_t *cursor = list->first->next; cursor; cursor = cursor->next)
+    {
+      ++visited;
+      if (!prop(cursor->value, extra))
+        {
+          LIST_COUNT(list, visited, visited);
+          return false;
+        }
     }
+  LIST_COUNT(list, visited, visited);
 
-  iterator_destroy(iter);
-  return result;
+  return true;
 }
 
 bool linked_list_any(list_t *list, predicate prop, const void *extra)
 {
-  bool result = false;
-  list_iterator_t *iter = list_iterator(list);
-  while (iterator_has_next(iter) && !result)
+  if (list->engine)
     {
-      result = !result && prop(iterator_current(iter), extra);
-      iterator_next(iter);
+      return list->engine->any(list, prop, extra);
+    }
+  size_t visited = 0;
+  for (const link_t *cursor = list->first->next; cursor; cursor = cursor->next)
+    {
+      ++visited;
+      if (prop(cursor->value, extra))
+        {
+          LIST_COUNT(list, visited, visited);
+          return true;
+        }
     }
+  LIST_COUNT(list, visited, visited);
 
-  iterator_destroy(iter);
-  return result;
+  return false;
 }
 
 void linked_list_apply_to_all(list_t *list, apply_function fun, const void *extra)
 {
-  for (link_t *cursor = list->first; cursor; cursor = cursor->next)
+  if (list->engine)
+    {
+      list->engine->apply_to_all(list, fun, extra);
+    }
+  else
+    {
+      for (link_t *cursor = list->first->next; cursor; cursor = cursor->next)
+        {
+          fun(&cursor->value, extra);
+        }
+    }
+  list_inner_index_rebuild(list);
+}
+
+bool linked_list_parallel_all(list_t *list, thread_pool_t *pool, predicate prop, const void *extra)
+{
+  if (list->size == 0)
+    {
+      return true;
+    }
+  list_parallel_t parallel = { .prop = prop, .extra = extra, .sought = false };
+  list_inner_parallel(list, pool, &parallel);
+
+  return !atomic_load(&parallel.found);
+}
+
+bool linked_list_parallel_any(list_t *list, thread_pool_t *pool, predicate prop, const void *extra)
+{
+  if (list->size == 0)
+    {
+      return false;
+    }
+  list_parallel_t parallel = { .prop = prop, .extra = extra, .sought = true };
+  list_inner_parallel(list, pool, &parallel);
+
+  return atomic_load(&parallel.found);
+}
+
+void linked_list_parallel_apply_to_all(list_t *list, thread_pool_t *pool, apply_function fun, const void *extra)
+{
+  if (list->size > 0)
+    {
+      list_parallel_t parallel = { .fun = fun, .extra = extra };
+      list_inner_parallel(list, pool, &parallel);
+    }
+  list_inner_index_rebuild(list);
+}
+
+void linked_list_set_counters(list_t *list, list_counters_t *counters)
+{
+  list->counters = counters;
+}
+
+bool linked_list_adaptive_stats(list_t *list, list_adaptive_stats_t *stats)
+{
+  if (list->adaptive == NULL)
+    {
+      return false;
+    }
+  *stats = list->adaptive->stats;
+  stats->layout = list->engine != NULL ? LIST_LAYOUT_ARRAY : LIST_LAYOUT_LINKED;
+
+  return true;
+}
+
+bool linked_list_save(list_t *list, const char *path)
+{
+  const size_t size = linked_list_size(list);
+  if (size >= UINT32_MAX)
+    {
+      puts("Lists of 2^32 - 1 elements or more cannot be saved!");
+      return false;
+    }
+  FILE *file = fopen(path, "wb");
+  if (file == NULL)
+    {
+      printf("Failed to open %s for writing.\n", path);
+      return false;
+    }
+  const uint64_t slots = size + 1;
+  list_file_header_t header = {
+    .version = LIST_FILE_VERSION,
+    .byte_order = LIST_FILE_BYTE_ORDER,
+    .elem_size = sizeof(elem_t),
+    .eq_kind = list->eq_kind,
+    .size = size,
+    .values = sizeof(list_file_header_t),
+    .next = sizeof(list_file_header_t) + slots * sizeof(elem_t),
+    .last = (uint32_t)size,
+  };
+  memcpy(header.magic, LIST_FILE_MAGIC, sizeof(header.magic));
+  bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+
+  // The elements go to consecutive slots in order, after the sentinel in slot 0.
+  elem_t values[LIST_FILE_BLOCK];
+  memset(&values[0], 0, sizeof(elem_t));
+  size_t count = 1;
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  while (written && iterator_has_next(iter))
+    {
+      values[count++] = iterator_next(iter);
+      if (count == LIST_FILE_BLOCK)
+        {
+          written = fwrite(values, sizeof(elem_t), count, file) == count;
+          count = 0;
+        }
+    }
+  written = written && fwrite(values, sizeof(elem_t), count, file) == count;
+
+  // Every slot links to the next one, and the last slot ends the chain.
+  uint32_t links[LIST_FILE_BLOCK];
+  for (uint64_t slot = 0; written && slot < slots; slot += count)
+    {
+      count = slots - slot < LIST_FILE_BLOCK ? slots - slot : LIST_FILE_BLOCK;
+      for (size_t i = 0; i < count; ++i)
+        {
+          links[i] = slot + i + 1 < slots ? (uint32_t)(slot + i + 1) : 0;
+        }
+      written = fwrite(links, sizeof(uint32_t), count, file) == count;
+    }
+  written = fclose(file) == 0 && written;
+  if (!written)
+    {
+      printf("Failed to write %s.\n", path);
+    }
+
+  return written;
+}
+
+list_t *linked_list_open_mmap(const char *path, eq_function fun)
+{
+  const int fd = open(path, O_RDONLY);
+  if (fd < 0)
+    {
+      printf("Failed to open %s.\n", path);
+      return NULL;
+    }
+  struct stat status;
+  void *mapping = MAP_FAILED;
+  if (fstat(fd, &status) == 0 && (size_t)status.st_size >= sizeof(list_file_header_t))
+    {
+      // A private writable mapping lets the list change its pages without changing the file.
+      mapping = mmap(NULL, status.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    }
+  close(fd);
+  if (mapping == MAP_FAILED)
+    {
+      printf("Failed to map %s.\n", path);
+      return NULL;
+    }
+  const size_t length = status.st_size;
+  const list_file_header_t *header = mapping;
+  if (!list_inner_file_valid(header, length))
+    {
+      printf("%s is not a list file written on this kind of machine.\n", path);
+      munmap(mapping, length);
+      return NULL;
+    }
+  const list_options_t options = { .fun = fun, .eq_kind = header->eq_kind, .layout = LIST_LAYOUT_COMPACT };
+  list_t *list = linked_list_create_with(&options);
+  if (list == NULL)
+    {
+      munmap(mapping, length);
+      return NULL;
+    }
+  compact_map(list, mapping, length, (elem_t *)((char *)mapping + header->values),
+              (uint32_t *)((char *)mapping + header->next), (uint32_t)(header->size + 1), header->last, header->size);
+
+  return list;
+}
+
+bool linked_list_write_fd(list_t *list, const int fd)
+{
+  list_stream_header_t header = {
+    .version = LIST_FILE_VERSION,
+    .byte_order = LIST_FILE_BYTE_ORDER,
+    .elem_size = sizeof(elem_t),
+    .eq_kind = list->eq_kind,
+    .size = linked_list_size(list),
+  };
+  memcpy(header.magic, LIST_STREAM_MAGIC, sizeof(header.magic));
+  bool written = true;
+  if (list->engine == &array_engine)
+    {
+      // The elements are already contiguous on either side of the gap, so they are written in place.
+      const elem_t *segments[2];
+      size_t counts[2];
+      array_segments(list, segments, counts);
+      struct iovec iov[] = {
+        { .iov_base = &header, .iov_len = sizeof(header) },
+        { .iov_base = (void *)segments[0], .iov_len = counts[0] * sizeof(elem_t) },
+        { .iov_base = (void *)segments[1], .iov_len = counts[1] * sizeof(elem_t) },
+      };
+      written = list_inner_write_all(fd, iov, 3);
+    }
+  else
+    {
+      struct iovec iov = { .iov_base = &header, .iov_len = sizeof(header) };
+      written = list_inner_write_all(fd, &iov, 1);
+      elem_t values[LIST_FILE_BLOCK];
+      size_t count = 0;
+      list_iterator_storage_t storage;
+      list_iterator_t *iter = list_iterator_init(&storage, list);
+      while (written && iterator_has_next(iter))
+        {
+          values[count++] = iterator_next(iter);
+          if (count == LIST_FILE_BLOCK || !iterator_has_next(iter))
+            {
+              iov = (struct iovec) { .iov_base = values, .iov_len = count * sizeof(elem_t) };
+              written = list_inner_write_all(fd, &iov, 1);
+              count = 0;
+            }
+        }
+    }
+  if (!written)
+    {
+      puts("Failed to write a list to a file descriptor.");
+    }
+
+  return written;
+}
+
+list_t *linked_list_read_fd(const int fd, const list_options_t *options)
+{
+  list_stream_header_t header;
+  if (!list_inner_read_all(fd, &header, sizeof(header))
+      || memcmp(header.magic, LIST_STREAM_MAGIC, sizeof(header.magic)) != 0
+      || header.version != LIST_FILE_VERSION
+      || header.byte_order != LIST_FILE_BYTE_ORDER
+      || header.elem_size != sizeof(elem_t)
+      || header.eq_kind > LIST_EQ_POINTER
+      || header.size > SIZE_MAX / sizeof(link_t))
+    {
+      puts("Failed to read a list written on this kind of machine from a file descriptor.");
+      return NULL;
+    }
+  const list_options_t defaults = { .eq_kind = header.eq_kind, .private_pool = true };
+  list_t *list = linked_list_create_with(options != NULL ? options : &defaults);
+  if (list == NULL || header.size == 0)
+    {
+      return list;
+    }
+
+  // Links are taken a block at a time as the elements arrive, so a stream that
+  // ends early never costs more memory than the elements it actually held.
+  elem_t values[LIST_FILE_BLOCK];
+  for (uint64_t left = header.size; left > 0;)
     {
-      fun(&cursor->value, extra);
+      const size_t count = left < LIST_FILE_BLOCK ? left : LIST_FILE_BLOCK;
+      const size_t size = linked_list_size(list);
+      if (!list_inner_read_all(fd, values, count * sizeof(elem_t)))
+        {
+          puts("Failed to read a list from a file descriptor.");
+        }
+      else
+        {
+          linked_list_append_array(list, values, count);
+        }
+      if (linked_list_size(list) != size + count)
+        {
+          // The elements read so far came from the stream, so they are not released.
+          list->destructor = NULL;
+          linked_list_destroy(list);
+          return NULL;
+        }
+      left -= count;
     }
+
+  return list;
 }
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "linked_list.h"
+#include "iterator.h"
+#include "pool.h"
+#include "hash_index.h"
+
+/**
+ * @file list_engine.h
+ * @brief Internal representation of linked lists and their storage engines.
+ *
+ * This header file is private to the implementation. It defines the structures
+ * behind list_t and list_iterator_t, and the table of operations that an
+ * alternative storage engine implements. A list without an engine stores its
+ * elements in a chain of links, which is handled directly in linked_list.c.
+ * A list with an engine forwards every operation to it, after the public
+ * layer has validated and adjusted any index.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Add the work of a walk to the counters of a list, if it has any.
+#define LIST_COUNT(list, calls, nodes)                  \
+  do                                                    \
+    {                                                   \
+      if ((list)->counters != NULL)                     \
+        {                                               \
+          (list)->counters->predicate_calls += (calls); \
+          (list)->counters->nodes_visited += (nodes);   \
+        }                                               \
+    }                                                   \
+  while (0)
+
+/// Link pointer to an element stored in a linked list.
+typedef struct link link_t;
+
+/// Link pointer to an element stored in a linked list.
+struct link
+{
+  elem_t value;   // Element value.
+  link_t *next;   // Next element.
+};
+
+/// Link of a doubly linked list, which also points back to the previous element.
+typedef struct doubly_link
+{
+  link_t link;    // Element value and next element.
+  link_t *prev;   // Previous element, or NULL for the sentinel.
+} doubly_link_t;
+
+/// Table of operations implemented by an alternative storage engine.
+typedef struct list_engine list_engine_t;
+
+/// Run of consecutive elements that a parallel operation hands to one thread.
+typedef struct list_chunk
+{
+  void *node;     // Link or storage node holding the next element of the run.
+  size_t offset;  // Position of the next element within node, for engines with blocks of elements.
+  size_t length;  // Number of elements left in the run.
+  size_t nodes;   // Number of links or storage nodes entered so far.
+} list_chunk_t;
+
+/// State of a list with the adaptive layout.
+typedef struct list_adaptive
+{
+  list_adaptive_stats_t stats; // Statistics, with the counts of accesses since the last decision.
+  unsigned to_array;  // Percentage of positional accesses that moves the list to the array layout.
+  unsigned to_linked; // Percentage of positional accesses that moves the list back to the linked layout.
+} list_adaptive_t;
+
+/// Linked list structure for holding generic elements.
+struct list
+{
+  link_t *first;    // Pointer to first element in a linked list.
+  link_t *last;     // Pointer to last element in a linked list.
+  size_t size;      // Number of elements stored in a linked list.
+  eq_function fun;  // Function pointer for element equality comparison.
+  list_eq_kind_t eq_kind; // Built-in equality comparison that fun performs, or LIST_EQ_CUSTOM.
+  pool_t *pool;     // Pool that links are allocated from, or NULL to use malloc.
+  bool owns_pool;   // True if the pool is private to the list.
+  const list_engine_t *engine; // Alternative storage engine, or NULL for a chain of links.
+  void *store;      // Storage owned by the engine.
+  hash_index_t *index; // Occurrences of every element, or NULL without a hash index.
+  struct skip_index *skip; // Skip index for positional access, or NULL without one.
+  bool doubly;      // True if links are doubly_link_t and point back to the previous element.
+  link_t *cursor;   // Link last reached by a positional access, starting at the sentinel.
+  size_t cursor_position; // Position of the cursor, where the sentinel is at position 0.
+  list_counters_t *counters; // Counters of the work done by all and any, or NULL.
+  free_function destructor; // Function called for every element the list discards, or NULL.
+  arena_t *arena;   // Arena the list, its links and its iterators come from, or NULL.
+  link_t *spare;    // Links released by a list in an arena, reused before taking more from the arena.
+  list_adaptive_t *adaptive; // State of the adaptive layout, or NULL for a list with a fixed layout.
+};
+
+/// Iterator for a linked list.
+struct iter
+{
+  link_t *current;  // Pointer to the current link.
+  list_t* list;     // The linked list itself.
+  void *node;       // Current storage node of an alternative engine.
+  size_t offset;    // Position of the next element within the current node.
+};
+
+/**
+ * @brief Table of operations implemented by an alternative storage engine.
+ *
+ * Indices passed to the engine are already validated, so that they are in
+ * [0, n] for insert and [0, n-1] for remove and get. All operations that add
+ * or remove elements keep list->size up to date, including the iterator
+ * operations. Operations that add an element return false if memory allocation
+ * failed, in which case the list is left unchanged. The hash index is
+ * maintained by the public layer.
+ *
+ * For parallel operations, split cuts a non-empty list into at most count runs
+ * of about equal length and returns their number, and chunk_next returns the
+ * next element of a run, or NULL once the run is exhausted. sort performs a
+ * stable sort and returns false if memory allocation failed, in which case the
+ * list is left unchanged. filter removes in one pass the elements for which
+ * the predicate returns matching, and returns their number. clear and filter
+ * call list->destructor, if set, for every element they discard.
+ **/
+struct list_engine
+{
+  bool (*create)(list_t *list);   // Allocate the initial storage, returns false on failure.
+  void (*destroy)(list_t *list);  // Free all storage.
+  bool (*append)(list_t *list, const elem_t value);
+  bool (*prepend)(list_t *list, const elem_t value);
+  bool (*insert)(list_t *list, const size_t index, const elem_t value);
+  elem_t (*remove)(list_t *list, const size_t index);
+  elem_t (*get)(list_t *list, const size_t index);
+  bool (*contains)(list_t *list, const elem_t element);
+  void (*clear)(list_t *list);
+  bool (*all)(list_t *list, predicate prop, const void *extra);
+  bool (*any)(list_t *list, predicate prop, const void *extra);
+  void (*apply_to_all)(list_t *list, apply_function fun, const void *extra);
+  void (*iterator_reset)(list_iterator_t *iter);
+  bool (*iterator_has_next)(list_iterator_t *iter);
+  elem_t (*iterator_next)(list_iterator_t *iter);
+  elem_t (*iterator_remove)(list_iterator_t *iter);
+  bool (*iterator_insert)(list_iterator_t *iter, const elem_t element);
+  elem_t (*iterator_current)(list_iterator_t *iter);
+  bool (*iterator_has_previous)(list_iterator_t *iter);
+  elem_t (*iterator_previous)(list_iterator_t *iter);
+  void (*iterator_to_end)(list_iterator_t *iter);
+  size_t (*split)(list_t *list, list_chunk_t *chunks, const size_t count);
+  elem_t *(*chunk_next)(list_chunk_t *chunk);
+  bool (*sort)(list_t *list, cmp_function cmp);
+  size_t (*filter)(list_t *list, predicate prop, const void *extra, const bool matching);
+};
+
+/// Engine storing elements in a chain of nodes that each hold a cache line of elements.
+extern const list_engine_t unrolled_engine;
+
+/// Engine storing elements in one contiguous gap buffer.
+extern const list_engine_t array_engine;
+
+/// Engine storing a chain of elements in growable arrays, linked by 32-bit indices.
+extern const list_engine_t compact_engine;
+
+/**
+ * @brief Get the elements of a list with the array engine as the two runs on either side of its gap.
+ * @param list A list with the array engine.
+ * @param segments Set to the first element of the run before the gap and of the run after it.
+ * @param counts Set to the number of elements in both runs, which together hold the list in order.
+ **/
+void array_segments(list_t *list, const elem_t **segments, size_t *counts);
+
+/**
+ * @brief Give an empty compact list the slots stored in a private file mapping.
+ *
+ * The slots are used in place, so that the mapping is neither read nor copied
+ * up front. The list owns the mapping from then on, and unmaps it when it is
+ * destroyed or needs more slots, in which case the slots move to the heap.
+ *
+ * @param list An empty list with the compact engine.
+ * @param mapping The mapping, made with MAP_PRIVATE and PROT_READ | PROT_WRITE.
+ * @param length The length of the mapping in bytes.
+ * @param values The elements of the slots, within the mapping.
+ * @param next The next slot of every slot, within the mapping.
+ * @param slots The number of slots, including the sentinel in slot 0.
+ * @param last The slot of the last element, or 0 if there is none.
+ * @param size The number of elements chained from the sentinel.
+ **/
+void compact_map(list_t *list, void *mapping, const size_t length, elem_t *values, uint32_t *next,
+                 const uint32_t slots, const uint32_t last, const size_t size);
@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include "lockfree_queue.h"
+#include "hazard.h"
+
+/**
+ * @file lockfree_queue.c
+ * @brief Implementation of the lock-free FIFO queue.
+ *
+ * The head always points to a sentinel link, whose successor holds the first
+ * element. Removing an element turns its link into the new sentinel and
+ * retires the old one. The tail points to the last link or, briefly, to its
+ * predecessor, in which case any thread that notices helps to swing it forward.
+ *
+ * Hazard slot 0 protects the head or tail link being worked on, and slot 1
+ * the successor of the head.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Size of a cache line, which keeps the head and the tail from sharing one.
+#define QUEUE_CACHE_LINE 64
+
+/// Link of a lock-free queue.
+typedef struct qlink qlink_t;
+
+/// Link of a lock-free queue.
+struct qlink
+{
+  elem_t value;          // Element value.
+  _Atomic(void *) next;  // Next link (qlink_t *), or NULL for the last link.
+};
+
+/// Lock-free FIFO queue for holding generic elements.
+struct lockfree_queue
+{
+  _Alignas(QUEUE_CACHE_LINE) _Atomic(void *) head;  // Sentinel link (qlink_t *).
+  _Alignas(QUEUE_CACHE_LINE) _Atomic(void *) tail;  // Last link or its predecessor (qlink_t *).
+  _Alignas(QUEUE_CACHE_LINE) atomic_size_t size;    // Number of elements, never below the true number.
+};
+
+/**
+ * @brief Create a new link.
+ * @param value Element value to set.
+ * @return A pointer to the newly created link, or NULL if memory allocation failed.
+ **/
+static qlink_t *qlink_new(const elem_t value);
+
+/**
+ * @brief Create a new link.
+ * @param value Element value to set.
+ * @return A pointer to the newly created link, or NULL if memory allocation failed.
+ **/
+static qlink_t *qlink_new(const elem_t value)
+{
+  qlink_t *link = malloc(sizeof(qlink_t));
+  if (link == NULL)
+    {
+      puts("Failed to allocate memory for another link.");
+      return NULL;
+    }
+  link->value = value;
+  atomic_init(&link->next, NULL);
+
+  return link;
+}
+
+lockfree_queue_t *lockfree_queue_create(void)
+{
+  lockfree_queue_t *queue = aligned_alloc(QUEUE_CACHE_LINE, sizeof(lockfree_queue_t));
+  if (queue == NULL)
+    {
+      puts("Failed to allocate memory for a lock-free queue.");
+      return NULL;
+    }
+  memset(queue, 0, sizeof(lockfree_queue_t));
+  qlink_t *sentinel = qlink_new((elem_t) { .i = 0 });
+  if (sentinel == NULL)
+    {
+      free(queue);
+      return NULL;
+    }
+  atomic_init(&queue->head, sentinel);
+  atomic_init(&queue->tail, sentinel);
+  atomic_init(&queue->size, 0);
+
+  return queue;
+}
+
+void lockfree_queue_destroy(lockfree_queue_t *queue)
+{
+  qlink_t *link = atomic_load(&queue->head);
+  while (link != NULL)
+    {
+      qlink_t *next = atomic_load(&link->next);
+      free(link);
+      link = next;
+    }
+  hazard_record_t *record = hazard_record();
+  if (record != NULL)
+    {
+      hazard_collect(record);
+    }
+  free(queue);
+}
+
+bool lockfree_queue_append(lockfree_queue_t *queue, const elem_t value)
+{
+  hazard_record_t *record = hazard_record();
+  qlink_t *link = record ? qlink_new(value) : NULL;
+  if (link == NULL)
+    {
+      puts("Append failed due to memory corruption!");
+      return false;
+    }
+  atomic_fetch_add_explicit(&queue->size, 1, memory_order_relaxed);
+  while (true)
+    {
+      qlink_t *last = hazard_protect(record, 0, &queue->tail);
+      void *next = atomic_load(&last->next);
+      if (last != atomic_load(&queue->tail))
+        {
+          continue;
+        }
+      if (next != NULL)
+        {
+          // The tail is lagging behind, help to move it forward.
+          void *expected = last;
+          atomic_compare_exchange_weak(&queue->tail, &expected, next);
+          continue;
+        }
+      void *expected_next = NULL;
+      if (atomic_compare_exchange_weak(&last->next, &expected_next, link))
+        {
+          void *expected = last;
+          atomic_compare_exchange_strong(&queue->tail, &expected, link);
+          break;
+        }
+    }
+  hazard_clear(record);
+
+  return true;
+}
+
+bool lockfree_queue_pop_front(lockfree_queue_t *queue, elem_t *removed)
+{
+  hazard_record_t *record = hazard_record();
+  if (record == NULL)
+    {
+      return false;
+    }
+  while (true)
+    {
+      qlink_t *first = hazard_protect(record, 0, &queue->head);
+      void *last = atomic_load(&queue->tail);
+      qlink_t *next = hazard_protect(record, 1, &first->next);
+      if (first != atomic_load(&queue->head))
+        {
+          continue;
+        }
+      if (next == NULL)
+        {
+          hazard_clear(record);
+          return false;
+        }
+      if (first == last)
+        {
+          // The tail is lagging behind, help to move it forward.
+          atomic_compare_exchange_weak(&queue->tail, &last, next);
+          continue;
+        }
+      const elem_t value = next->value;
+      void *expected = first;
+      if (atomic_compare_exchange_weak(&queue->head, &expected, next))
+        {
+          hazard_clear(record);
+          atomic_fetch_sub_explicit(&queue->size, 1, memory_order_relaxed);
+          hazard_retire(record, first, free);
+          if (removed != NULL)
+            {
+              *removed = value;
+            }
+          return true;
+        }
+    }
+}
+
+size_t lockfree_queue_size(lockfree_queue_t *queue)
+{
+  return atomic_load_explicit(&queue->size, memory_order_relaxed);
+}
+
+bool lockfree_queue_is_empty(lockfree_queue_t *queue)
+{
+  hazard_record_t *record = hazard_record();
+  if (record == NULL)
+    {
+      return lockfree_queue_size(queue) == 0;
+    }
+  qlink_t *first = hazard_protect(record, 0, &queue->head);
+  const bool empty = atomic_load(&first->next) == NULL;
+  hazard_clear(record);
+
+  return empty;
+}
@@ -0,0 +1,291 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include "lockfree_set.h"
+#include "hazard.h"
+
+/**
+ * @file lockfree_set.c
+ * @brief Implementation of the lock-free ordered set.
+ *
+ * The set starts with a sentinel link that is never removed. A link whose next
+ * pointer carries the mark is logically deleted: its next pointer never changes
+ * again, and the link is unlinked by a compare-and-swap on the next pointer of
+ * its predecessor, after which it is retired.
+ *
+ * Every operation walks the chain with three hazard slots: one for the link
+ * before the current one, one for the current link and one for its successor.
+ * The slots trade roles as the walk moves on, so every link is published once.
+ * A link is only trusted once the pointer to it has been published and the
+ * predecessor has been seen to still point to it, unmarked.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Hazard slot of the successor of the current link when a walk starts.
+#define SLOT_NEXT 0
+/// Hazard slot of the current link when a walk starts.
+#define SLOT_CURRENT 1
+/// Hazard slot of the link before the current one when a walk starts.
+#define SLOT_PREVIOUS 2
+
+/// True if a next pointer carries the mark of a deleted link.
+#define IS_MARKED(pointer) (((uintptr_t)(pointer) & 1) != 0)
+/// A next pointer with the mark of a deleted link.
+#define MARKED(pointer) ((void *)((uintptr_t)(pointer) | 1))
+/// A next pointer without the mark of a deleted link.
+#define UNMARKED(pointer) ((void *)((uintptr_t)(pointer) & ~(uintptr_t)1))
+
+/// Link of a lock-free set.
+typedef struct slink slink_t;
+
+/// Link of a lock-free set.
+struct slink
+{
+  elem_t value;          // Element value.
+  _Atomic(void *) next;  // Next link (slink_t *), marked once the link is deleted.
+};
+
+/// Lock-free ordered set for holding generic elements.
+struct lockfree_set
+{
+  slink_t head;          // Sentinel link, which is never deleted.
+  atomic_size_t size;    // Number of elements, never below the true number.
+  cmp_function order;    // Function pointer that orders the elements.
+  eq_function fun;       // Function pointer for equality of elements ordered together, or NULL.
+};
+
+/**
+ * @brief Find the link of an element, unlinking deleted links on the way.
+ *
+ * On return the hazard slots protect the link that *previous belongs to and
+ * *current. If the element is not in the set, *current is the first link
+ * ordered after it, or NULL, and a new link belongs between the two.
+ *
+ * @param set The set.
+ * @param record The hazard record of the calling thread.
+ * @param value The value sought, or NULL to stop at the first link that is not deleted.
+ * @param previous Set to the next pointer that points to *current.
+ * @param current Set to the link of the element, or of its successor.
+ * @return True if the element was found, false otherwise.
+ **/
+static bool lockfree_set_inner_find(lockfree_set_t *set, hazard_record_t *record, const elem_t *value,
+                                    _Atomic(void *) **previous, slink_t **current);
+
+/**
+ * @brief Find the link of an element, unlinking deleted links on the way.
+ *
+ * On return the hazard slots protect the link that *previous belongs to and
+ * *current. If the element is not in the set, *current is the first link
+ * ordered after it, or NULL, and a new link belongs between the two.
+ *
+ * @param set The set.
+ * @param record The hazard record of the calling thread.
+ * @param value The value sought, or NULL to stop at the first link that is not deleted.
+ * @param previous Set to the next pointer that points to *current.
+ * @param current Set to the link of the element, or of its successor.
+ * @return True if the element was found, false otherwise.
+ **/
+static bool lockfree_set_inner_find(lockfree_set_t *set, hazard_record_t *record, const elem_t *value,
+                                    _Atomic(void *) **previous, slink_t **current)
+{
+ retry:;
+  size_t slot_previous = SLOT_PREVIOUS;
+  size_t slot_current = SLOT_CURRENT;
+  size_t slot_next = SLOT_NEXT;
+  _Atomic(void *) *prev = &set->head.next;
+  slink_t *cursor = hazard_protect(record, slot_current, prev);
+  while (cursor != NULL)
+    {
+      void *next = atomic_load(&cursor->next);
+      hazard_set(record, slot_next, next);
+      if (atomic_load(&cursor->next) != next || atomic_load(prev) != cursor)
+        {
+          goto retry;
+        }
+      if (IS_MARKED(next))
+        {
+          void *expected = cursor;
+          if (!atomic_compare_exchange_strong(prev, &expected, UNMARKED(next)))
+            {
+              goto retry;
+            }
+          hazard_retire(record, cursor, free);
+          cursor = UNMARKED(next);
+          const size_t slot = slot_current;
+          slot_current = slot_next;
+          slot_next = slot;
+          continue;
+        }
+      if (value == NULL)
+        {
+          break;
+        }
+      const int order = set->order(cursor->value, *value);
+      if (order > 0)
+        {
+          break;
+        }
+      if (order == 0 && (set->fun == NULL || set->fun(cursor->value, *value)))
+        {
+          *previous = prev;
+          *current = cursor;
+          return true;
+        }
+      const size_t slot = slot_previous;
+      slot_previous = slot_current;
+      slot_current = slot_next;
+      slot_next = slot;
+      prev = &cursor->next;
+      cursor = next;
+    }
+  *previous = prev;
+  *current = cursor;
+
+  return false;
+}
+
+lockfree_set_t *lockfree_set_create(cmp_function order, eq_function fun)
+{
+  lockfree_set_t *set = calloc(1, sizeof(lockfree_set_t));
+  if (set == NULL)
+    {
+      puts("Failed to allocate memory for a lock-free set.");
+      return NULL;
+    }
+  atomic_init(&set->head.next, NULL);
+  atomic_init(&set->size, 0);
+  set->order = order;
+  set->fun = fun;
+
+  return set;
+}
+
+void lockfree_set_destroy(lockfree_set_t *set)
+{
+  slink_t *link = UNMARKED(atomic_load(&set->head.next));
+  while (link != NULL)
+    {
+      slink_t *next = UNMARKED(atomic_load(&link->next));
+      free(link);
+      link = next;
+    }
+  hazard_record_t *record = hazard_record();
+  if (record != NULL)
+    {
+      hazard_collect(record);
+    }
+  free(set);
+}
+
+bool lockfree_set_insert(lockfree_set_t *set, const elem_t value)
+{
+  hazard_record_t *record = hazard_record();
+  slink_t *link = record ? malloc(sizeof(slink_t)) : NULL;
+  if (link == NULL)
+    {
+      puts("Insert failed due to memory corruption!");
+      return false;
+    }
+  link->value = value;
+  atomic_fetch_add_explicit(&set->size, 1, memory_order_relaxed);
+
+  bool inserted = false;
+  _Atomic(void *) *prev;
+  slink_t *cursor;
+  while (!lockfree_set_inner_find(set, record, &value, &prev, &cursor))
+    {
+      atomic_init(&link->next, cursor);
+      void *expected = cursor;
+      if (atomic_compare_exchange_strong(prev, &expected, link))
+        {
+          inserted = true;
+          break;
+        }
+    }
+  hazard_clear(record);
+  if (!inserted)
+    {
+      atomic_fetch_sub_explicit(&set->size, 1, memory_order_relaxed);
+      free(link);
+    }
+
+  return inserted;
+}
+
+bool lockfree_set_remove(lockfree_set_t *set, const elem_t value, elem_t *removed)
+{
+  hazard_record_t *record = hazard_record();
+  if (record == NULL)
+    {
+      return false;
+    }
+  _Atomic(void *) *prev;
+  slink_t *cursor;
+  while (lockfree_set_inner_find(set, record, &value, &prev, &cursor))
+    {
+      void *next = atomic_load(&cursor->next);
+      if (IS_MARKED(next) || !atomic_compare_exchange_strong(&cursor->next, &next, MARKED(next)))
+        {
+          // Another thread changed the link first, look again.
+          continue;
+        }
+      // The element is now removed, unlink it or leave that to the next walk.
+      if (removed != NULL)
+        {
+          *removed = cursor->value;
+        }
+      void *expected = cursor;
+      if (atomic_compare_exchange_strong(prev, &expected, next))
+        {
+          hazard_retire(record, cursor, free);
+        }
+      else
+        {
+          lockfree_set_inner_find(set, record, &value, &prev, &cursor);
+        }
+      hazard_clear(record);
+      atomic_fetch_sub_explicit(&set->size, 1, memory_order_relaxed);
+      return true;
+    }
+  hazard_clear(record);
+
+  return false;
+}
+
+bool lockfree_set_contains(lockfree_set_t *set, const elem_t value)
+{
+  hazard_record_t *record = hazard_record();
+  if (record == NULL)
+    {
+      return false;
+    }
+  _Atomic(void *) *prev;
+  slink_t *cursor;
+  const bool found = lockfree_set_inner_find(set, record, &value, &prev, &cursor);
+  hazard_clear(record);
+
+  return found;
+}
+
+size_t lockfree_set_size(lockfree_set_t *set)
+{
+  return atomic_load_explicit(&set->size, memory_order_relaxed);
+}
+
+bool lockfree_set_is_empty(lockfree_set_t *set)
+{
+  hazard_record_t *record = hazard_record();
+  if (record == NULL)
+    {
+      return lockfree_set_size(set) == 0;
+    }
+  _Atomic(void *) *prev;
+  slink_t *cursor;
+  lockfree_set_inner_find(set, record, NULL, &prev, &cursor);
+  hazard_clear(record);
+
+  return cursor == NULL;
+}
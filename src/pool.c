@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "pool.h"
+
+/**
+ * @file pool.c
+ * @brief Implementation of the slab allocator for fixed-size objects.
+ *
+ * This file contains the implementation of the pool functions defined in
+ * pool.h. The detailed descriptions of the functions are provided in the
+ * header file.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Number of objects per slab when none is requested.
+#define POOL_DEFAULT_OBJECTS_PER_SLAB 256
+
+/// Header of a slab, padded so that the objects following it are suitably aligned.
+typedef union slab slab_t;
+
+/// Header of a slab, padded so that the objects following it are suitably aligned.
+union slab
+{
+  slab_t *next;       // Previously allocated slab.
+  max_align_t align;  // Alignment of the objects following the header.
+};
+
+/// Released object, reused as a node in the intrusive free list.
+typedef struct free_object free_object_t;
+
+/// Released object, reused as a node in the intrusive free list.
+struct free_object
+{
+  free_object_t *next;  // Next released object.
+};
+
+/// Pool allocator for fixed-size objects.
+struct pool
+{
+  size_t object_size;       // Requested object size.
+  size_t stride;            // Distance between two objects in a slab.
+  size_t objects_per_slab;  // Number of objects in each slab.
+  slab_t *slabs;            // Most recently allocated slab.
+  char *bump;               // Next never used object in the current slab.
+  char *bump_end;           // End of the current slab.
+  free_object_t *free_list; // Released objects available for reuse.
+};
+
+/**
+ * @brief Allocate a new slab and make it the current one.
+ * @param pool The pool to grow.
+ * @return True if the slab was allocated, false otherwise.
+ **/
+static bool pool_inner_grow(pool_t *pool);
+
+/**
+ * @brief Allocate a new slab and make it the current one.
+ * @param pool The pool to grow.
+ * @return True if the slab was allocated, false otherwise.
+ **/
+static bool pool_inner_grow(pool_t *pool)
+{
+  const size_t bytes = pool->stride * pool->objects_per_slab;
+  slab_t *slab = malloc(sizeof(slab_t) + bytes);
+  if (slab == NULL)
+    {
+      puts("Failed to allocate memory for another slab.");
+      return false;
+    }
+  slab->next = pool->slabs;
+  pool->slabs = slab;
+  pool->bump = (char *)(slab + 1);
+  pool->bump_end = pool->bump + bytes;
+
+  return true;
+}
+
+pool_t *pool_create(const size_t object_size, const size_t objects_per_slab)
+{
+  pool_t *pool = calloc(1, sizeof(pool_t));
+  if (pool == NULL)
+    {
+      puts("Failed to allocate memory for a pool.");
+      return NULL;
+    }
+  const size_t align = sizeof(free_object_t);
+  size_t stride = object_size < align ? align : object_size;
+  stride = (stride + align - 1) / align * align;
+
+  pool->object_size = object_size;
+  pool->stride = stride;
+  pool->objects_per_slab = objects_per_slab > 0 ? objects_per_slab : POOL_DEFAULT_OBJECTS_PER_SLAB;
+
+  return pool;
+}
+
+void pool_destroy(pool_t *pool)
+{
+  pool_reset(pool);
+  free(pool);
+}
+
+void pool_reset(pool_t *pool)
+{
+  slab_t *slab = pool->slabs;
+  while (slab != NULL)
+    {
+      slab_t *next = slab->next;
+      free(slab);
+      slab = next;
+    }
+  pool->slabs = NULL;
+  pool->bump = pool->bump_end = NULL;
+  pool->free_list = NULL;
+}
+
+void *pool_alloc(pool_t *pool)
+{
+  free_object_t *object = pool->free_list;
+  if (object != NULL)
+    {
+      pool->free_list = object->next;
+      return object;
+    }
+  if (pool->bump == pool->bump_end && !pool_inner_grow(pool))
+    {
+      return NULL;
+    }
+  void *result = pool->bump;
+  pool->bump += pool->stride;
+
+  return result;
+}
+
+void *pool_alloc_many(pool_t *pool, const size_t count)
+{
+  if (count > (SIZE_MAX - sizeof(slab_t)) / pool->stride)
+    {
+      puts("Too many objects requested for one slab.");
+      return NULL;
+    }
+  slab_t *slab = malloc(sizeof(slab_t) + pool->stride * count);
+  if (slab == NULL)
+    {
+      puts("Failed to allocate memory for another slab.");
+      return NULL;
+    }
+  if (pool->slabs == NULL)
+    {
+      slab->next = NULL;
+      pool->slabs = slab;
+    }
+  else
+    {
+      slab->next = pool->slabs->next;
+      pool->slabs->next = slab;
+    }
+
+  return slab + 1;
+}
+
+void pool_free(pool_t *pool, void *object)
+{
+  if (object == NULL)
+    {
+      return;
+    }
+  free_object_t *released = object;
+  released->next = pool->free_list;
+  pool->free_list = released;
+}
+
+size_t pool_object_size(pool_t *pool)
+{
+  return pool->object_size;
+}
+
+size_t pool_object_stride(pool_t *pool)
+{
+  return pool->stride;
+}
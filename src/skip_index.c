@@ -0,0 +1,515 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "skip_index.h"
+
+/**
+ * @file skip_index.c
+ * @brief Implementation of the indexable skip list over a chain of links.
+ *
+ * This file contains the implementation of the skip index functions defined in
+ * skip_index.h. The detailed descriptions of the functions are provided in the
+ * header file.
+ *
+ * A link gets a tower of height h with probability (1/4)^h * 3/4, so that every
+ * lane skips four links of the lane below on average. The head tower stands on
+ * the sentinel. Spans of the head tower and positions of the last tower in
+ * every lane are stored relative to a shift, which lets the front of the chain
+ * grow and shrink without touching every lane.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Maximum number of lanes above the chain of links.
+#define SKIP_INDEX_MAX_LEVEL 32
+
+/// Tower standing on a link.
+typedef struct skip_tower skip_tower_t;
+
+/// One lane of a tower.
+typedef struct skip_lane
+{
+  skip_tower_t *next;   // Next tower reaching this lane, or NULL.
+  size_t span;          // Number of links from this tower to the next one.
+} skip_lane_t;
+
+/// Tower standing on a link.
+struct skip_tower
+{
+  link_t *link;         // The link the tower stands on.
+  size_t height;        // Number of lanes of the tower.
+  skip_lane_t lanes[];  // Lanes, lowest first.
+};
+
+/// Indexable skip list over a chain of links.
+struct skip_index
+{
+  skip_tower_t *head;                         // Tower standing on the sentinel.
+  skip_tower_t *tail[SKIP_INDEX_MAX_LEVEL];   // Last tower in every lane, or NULL if the lane is empty.
+  size_t tail_position[SKIP_INDEX_MAX_LEVEL]; // Position of the last tower in every lane, minus shift.
+  size_t shift;                               // Offset added to head spans and tail positions.
+  size_t levels;                              // Number of lanes in use.
+  uint64_t random;                            // State of the random number generator.
+  bool dirty;                                 // True if the index must be rebuilt before use.
+};
+
+/**
+ * @brief Draw the height of a new tower.
+ * @param index The index.
+ * @return A height in [0, SKIP_INDEX_MAX_LEVEL].
+ **/
+static size_t skip_index_inner_height(skip_index_t *index);
+
+/**
+ * @brief Create a tower.
+ * @param link The link the tower stands on.
+ * @param height The number of lanes.
+ * @return A pointer to the tower, or NULL if memory allocation failed.
+ **/
+static skip_tower_t *skip_index_inner_tower_new(link_t *link, const size_t height);
+
+/**
+ * @brief Get the span of a lane of a tower.
+ * @param index The index.
+ * @param tower The tower.
+ * @param lane The lane.
+ * @return The number of links from the tower to the next one in the lane.
+ **/
+static size_t skip_index_inner_span(skip_index_t *index, skip_tower_t *tower, const size_t lane);
+
+/**
+ * @brief Set the span of a lane of a tower.
+ * @param index The index.
+ * @param tower The tower.
+ * @param lane The lane.
+ * @param span The number of links from the tower to the next one in the lane.
+ **/
+static void skip_index_inner_set_span(skip_index_t *index, skip_tower_t *tower, const size_t lane, const size_t span);
+
+/**
+ * @brief Find the last tower at or before a position in every lane in use.
+ * @param index The index.
+ * @param position The position.
+ * @param update Set to the last tower at or before the position in every lane.
+ * @param rank Set to the positions of the towers in update.
+ **/
+static void skip_index_inner_search(skip_index_t *index, const size_t position,
+                                    skip_tower_t **update, size_t *rank);
+
+/**
+ * @brief Add a tower at the end of all of its lanes.
+ * @param index The index.
+ * @param tower The tower.
+ * @param position The position of the link the tower stands on.
+ **/
+static void skip_index_inner_push_back(skip_index_t *index, skip_tower_t *tower, const size_t position);
+
+/**
+ * @brief Free all towers except the head tower and empty all lanes.
+ * @param index The index.
+ **/
+static void skip_index_inner_free_towers(skip_index_t *index);
+
+/**
+ * @brief Rebuild the index from the chain of links.
+ * @param index The index.
+ * @return True if the index was rebuilt, false if memory allocation failed.
+ **/
+static bool skip_index_inner_rebuild(skip_index_t *index);
+
+/**
+ * @brief Draw the height of a new tower.
+ * @param index The index.
+ * @return A height in [0, SKIP_INDEX_MAX_LEVEL].
+ **/
+static size_t skip_index_inner_height(skip_index_t *index)
+{
+  index->random ^= index->random << 13;
+  index->random ^= index->random >> 7;
+  index->random ^= index->random << 17;
+
+  uint64_t bits = index->random;
+  size_t height = 0;
+  while (height < SKIP_INDEX_MAX_LEVEL && (bits & 3) == 0)
+    {
+      height += 1;
+      bits >>= 2;
+    }
+
+  return height;
+}
+
+/**
+ * @brief Create a tower.
+ * @param link The link the tower stands on.
+ * @param height The number of lanes.
+ * @return A pointer to the tower, or NULL if memory allocation failed.
+ **/
+static skip_tower_t *skip_index_inner_tower_new(link_t *link, const size_t height)
+{
+  skip_tower_t *tower = calloc(1, sizeof(skip_tower_t) + height * sizeof(skip_lane_t));
+  if (tower == NULL)
+    {
+      puts("Failed to allocate memory for another tower.");
+      return NULL;
+    }
+  tower->link = link;
+  tower->height = height;
+
+  return tower;
+}
+
+/**
+ * @brief Get the span of a lane of a tower.
+ * @param index The index.
+ * @param tower The tower.
+ * @param lane The lane.
+ * @return The number of links from the tower to the next one in the lane.
+ **/
+static size_t skip_index_inner_span(skip_index_t *index, skip_tower_t *tower, const size_t lane)
+{
+  const size_t span = tower->lanes[lane].span;
+  return tower == index->head ? span + index->shift : span;
+}
+
+/**
+ * @brief Set the span of a lane of a tower.
+ * @param index The index.
+ * @param tower The tower.
+ * @param lane The lane.
+ * @param span The number of links from the tower to the next one in the lane.
+ **/
+static void skip_index_inner_set_span(skip_index_t *index, skip_tower_t *tower, const size_t lane, const size_t span)
+{
+  tower->lanes[lane].span = tower == index->head ? span - index->shift : span;
+}
+
+/**
+ * @brief Find the last tower at or before a position in every lane in use.
+ * @param index The index.
+ * @param position The position.
+ * @param update Set to the last tower at or before the position in every lane.
+ * @param rank Set to the positions of the towers in update.
+ **/
+static void skip_index_inner_search(skip_index_t *index, const size_t position,
+                                    skip_tower_t **update, size_t *rank)
+{
+  skip_tower_t *tower = index->head;
+  size_t current = 0;
+  for (size_t lane = index->levels; lane > 0; --lane)
+    {
+      while (tower->lanes[lane - 1].next != NULL
+             && current + skip_index_inner_span(index, tower, lane - 1) <= position)
+        {
+          current += skip_index_inner_span(index, tower, lane - 1);
+          tower = tower->lanes[lane - 1].next;
+        }
+      update[lane - 1] = tower;
+      rank[lane - 1] = current;
+    }
+}
+
+/**
+ * @brief Add a tower at the end of all of its lanes.
+ * @param index The index.
+ * @param tower The tower.
+ * @param position The position of the link the tower stands on.
+ **/
+static void skip_index_inner_push_back(skip_index_t *index, skip_tower_t *tower, const size_t position)
+{
+  for (size_t lane = 0; lane < tower->height; ++lane)
+    {
+      skip_tower_t *previous = index->tail[lane] ? index->tail[lane] : index->head;
+      const size_t previous_position = index->tail[lane] ? index->tail_position[lane] + index->shift : 0;
+      previous->lanes[lane].next = tower;
+      skip_index_inner_set_span(index, previous, lane, position - previous_position);
+      index->tail[lane] = tower;
+      index->tail_position[lane] = position - index->shift;
+    }
+  if (tower->height > index->levels)
+    {
+      index->levels = tower->height;
+    }
+}
+
+/**
+ * @brief Free all towers except the head tower and empty all lanes.
+ * @param index The index.
+ **/
+static void skip_index_inner_free_towers(skip_index_t *index)
+{
+  skip_tower_t *tower = index->head->lanes[0].next;
+  while (tower != NULL)
+    {
+      skip_tower_t *next = tower->lanes[0].next;
+      free(tower);
+      tower = next;
+    }
+  for (size_t lane = 0; lane < SKIP_INDEX_MAX_LEVEL; ++lane)
+    {
+      index->head->lanes[lane].next = NULL;
+      index->head->lanes[lane].span = 0;
+      index->tail[lane] = NULL;
+      index->tail_position[lane] = 0;
+    }
+  index->shift = 0;
+  index->levels = 0;
+}
+
+/**
+ * @brief Rebuild the index from the chain of links.
+ * @param index The index.
+ * @return True if the index was rebuilt, false if memory allocation failed.
+ **/
+static bool skip_index_inner_rebuild(skip_index_t *index)
+{
+  skip_index_inner_free_towers(index);
+  size_t position = 1;
+  for (link_t *cursor = index->head->link->next; cursor; cursor = cursor->next, ++position)
+    {
+      const size_t height = skip_index_inner_height(index);
+      if (height == 0)
+        {
+          continue;
+        }
+      skip_tower_t *tower = skip_index_inner_tower_new(cursor, height);
+      if (tower == NULL)
+        {
+          skip_index_inner_free_towers(index);
+          return false;
+        }
+      skip_index_inner_push_back(index, tower, position);
+    }
+  index->dirty = false;
+
+  return true;
+}
+
+skip_index_t *skip_index_create(link_t *sentinel)
+{
+  skip_index_t *index = calloc(1, sizeof(skip_index_t));
+  if (index == NULL)
+    {
+      puts("Failed to allocate memory for a skip index.");
+      return NULL;
+    }
+  index->head = skip_index_inner_tower_new(sentinel, SKIP_INDEX_MAX_LEVEL);
+  if (index->head == NULL)
+    {
+      free(index);
+      return NULL;
+    }
+  index->random = 0x9E3779B97F4A7C15u;
+
+  return index;
+}
+
+void skip_index_destroy(skip_index_t *index)
+{
+  skip_index_inner_free_towers(index);
+  free(index->head);
+  free(index);
+}
+
+link_t *skip_index_link_at(skip_index_t *index, const size_t position)
+{
+  link_t *cursor = index->head->link;
+  size_t current = 0;
+  if (!index->dirty || skip_index_inner_rebuild(index))
+    {
+      skip_tower_t *update[SKIP_INDEX_MAX_LEVEL];
+      size_t rank[SKIP_INDEX_MAX_LEVEL];
+      skip_index_inner_search(index, position, update, rank);
+      if (index->levels > 0)
+        {
+          cursor = update[0]->link;
+          current = rank[0];
+        }
+    }
+  for (; current < position; ++current)
+    {
+      cursor = cursor->next;
+    }
+
+  return cursor;
+}
+
+void skip_index_insert(skip_index_t *index, link_t *link, const size_t position, const size_t size)
+{
+  if (index->dirty)
+    {
+      return;
+    }
+  const size_t height = skip_index_inner_height(index);
+  skip_tower_t *tower = NULL;
+  if (height > 0)
+    {
+      tower = skip_index_inner_tower_new(link, height);
+      if (tower == NULL)
+        {
+          index->dirty = true;
+          return;
+        }
+    }
+
+  if (position == size)
+    {
+      if (tower != NULL)
+        {
+          skip_index_inner_push_back(index, tower, position);
+        }
+      return;
+    }
+  if (position == 1)
+    {
+      // Every existing link moves one step back, which the shift accounts for.
+      index->shift += 1;
+      for (size_t lane = 0; tower != NULL && lane < height; ++lane)
+        {
+          skip_tower_t *first = index->head->lanes[lane].next;
+          tower->lanes[lane].next = first;
+          tower->lanes[lane].span = first ? skip_index_inner_span(index, index->head, lane) - 1 : 0;
+          index->head->lanes[lane].next = tower;
+          skip_index_inner_set_span(index, index->head, lane, 1);
+          if (first == NULL)
+            {
+              index->tail[lane] = tower;
+              index->tail_position[lane] = 1 - index->shift;
+            }
+        }
+      if (height > index->levels)
+        {
+          index->levels = height;
+        }
+      return;
+    }
+
+  const size_t levels = height > index->levels ? height : index->levels;
+  skip_tower_t *update[SKIP_INDEX_MAX_LEVEL];
+  size_t rank[SKIP_INDEX_MAX_LEVEL];
+  skip_index_inner_search(index, position - 1, update, rank);
+  for (size_t lane = index->levels; lane < levels; ++lane)
+    {
+      update[lane] = index->head;
+      rank[lane] = 0;
+    }
+  for (size_t lane = 0; lane < index->levels; ++lane)
+    {
+      if (index->tail[lane] != NULL && index->tail_position[lane] + index->shift >= position)
+        {
+          index->tail_position[lane] += 1;
+        }
+    }
+  for (size_t lane = 0; lane < levels; ++lane)
+    {
+      skip_tower_t *previous = update[lane];
+      skip_tower_t *next = previous->lanes[lane].next;
+      if (lane < height)
+        {
+          tower->lanes[lane].next = next;
+          tower->lanes[lane].span = next ? rank[lane] + skip_index_inner_span(index, previous, lane) + 1 - position : 0;
+          previous->lanes[lane].next = tower;
+          skip_index_inner_set_span(index, previous, lane, position - rank[lane]);
+          if (next == NULL)
+            {
+              index->tail[lane] = tower;
+              index->tail_position[lane] = position - index->shift;
+            }
+        }
+      else if (next != NULL)
+        {
+          skip_index_inner_set_span(index, previous, lane, skip_index_inner_span(index, previous, lane) + 1);
+        }
+    }
+  index->levels = levels;
+}
+
+void skip_index_remove(skip_index_t *index, const size_t position)
+{
+  if (index->dirty)
+    {
+      return;
+    }
+  skip_tower_t *removed = NULL;
+  if (position == 1)
+    {
+      skip_tower_t *first = index->head->lanes[0].next;
+      if (first != NULL && skip_index_inner_span(index, index->head, 0) == 1)
+        {
+          removed = first;
+          for (size_t lane = 0; lane < removed->height; ++lane)
+            {
+              skip_tower_t *next = removed->lanes[lane].next;
+              index->head->lanes[lane].next = next;
+              if (next != NULL)
+                {
+                  skip_index_inner_set_span(index, index->head, lane, removed->lanes[lane].span + 1);
+                }
+              else
+                {
+                  index->tail[lane] = NULL;
+                }
+            }
+        }
+      // Every remaining link moves one step forward, which the shift accounts for.
+      index->shift -= 1;
+    }
+  else
+    {
+      skip_tower_t *update[SKIP_INDEX_MAX_LEVEL];
+      size_t rank[SKIP_INDEX_MAX_LEVEL];
+      skip_index_inner_search(index, position - 1, update, rank);
+      for (size_t lane = 0; lane < index->levels; ++lane)
+        {
+          skip_tower_t *previous = update[lane];
+          skip_tower_t *next = previous->lanes[lane].next;
+          if (next == NULL)
+            {
+              continue;
+            }
+          const size_t span = skip_index_inner_span(index, previous, lane);
+          if (rank[lane] + span == position)
+            {
+              removed = next;
+              previous->lanes[lane].next = next->lanes[lane].next;
+              if (next->lanes[lane].next != NULL)
+                {
+                  skip_index_inner_set_span(index, previous, lane, span + next->lanes[lane].span - 1);
+                }
+              else
+                {
+                  index->tail[lane] = previous == index->head ? NULL : previous;
+                  index->tail_position[lane] = rank[lane] - index->shift;
+                }
+            }
+          else
+            {
+              skip_index_inner_set_span(index, previous, lane, span - 1);
+            }
+        }
+      for (size_t lane = 0; lane < index->levels; ++lane)
+        {
+          if (index->tail[lane] != NULL && index->tail_position[lane] + index->shift > position)
+            {
+              index->tail_position[lane] -= 1;
+            }
+        }
+    }
+  free(removed);
+  while (index->levels > 0 && index->head->lanes[index->levels - 1].next == NULL)
+    {
+      index->levels -= 1;
+    }
+}
+
+void skip_index_clear(skip_index_t *index)
+{
+  skip_index_inner_free_towers(index);
+  index->dirty = false;
+}
+
+void skip_index_invalidate(skip_index_t *index)
+{
+  index->dirty = true;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "list_engine.h"
+
+/**
+ * @file skip_index.h
+ * @brief Indexable skip list over the chain of links of a linked list.
+ *
+ * This header file is private to the implementation. It defines towers of
+ * express lanes above the chain of links, where every lane records how many
+ * links it skips. Finding the link at a position then takes expected O(log n)
+ * time. Positions count from the sentinel, which is at position 0, so the
+ * element at index i is at position i + 1.
+ *
+ * Links added at either end of the chain are recorded in expected O(1) time,
+ * other insertions and removals in expected O(log n) time. Changes to the
+ * chain that are not recorded must be reported with skip_index_invalidate,
+ * after which the index is rebuilt on its next use.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Indexable skip list over a chain of links.
+typedef struct skip_index skip_index_t;
+
+/**
+ * @brief Create a new skip index for an empty chain.
+ * @param sentinel The sentinel link at the start of the chain.
+ * @return A pointer to an empty index, or NULL if memory allocation failed.
+ **/
+skip_index_t *skip_index_create(link_t *sentinel);
+
+/**
+ * @brief Destroy a skip index and free its memory, but not the links.
+ * @param index The index to be destroyed.
+ **/
+void skip_index_destroy(skip_index_t *index);
+
+/**
+ * @brief Find the link at a position in expected O(log n) time.
+ * @param index The index.
+ * @param position A position in [0, n], where 0 is the sentinel.
+ * @return The link at the position.
+ **/
+link_t *skip_index_link_at(skip_index_t *index, const size_t position);
+
+/**
+ * @brief Record a link that has just been linked into the chain.
+ * @param index The index.
+ * @param link The new link.
+ * @param position The position of the new link, in [1, size].
+ * @param size The number of links after the insertion, excluding the sentinel.
+ **/
+void skip_index_insert(skip_index_t *index, link_t *link, const size_t position, const size_t size);
+
+/**
+ * @brief Record that the link at a position has been unlinked from the chain.
+ * @param index The index.
+ * @param position The position the link had, in [1, n].
+ **/
+void skip_index_remove(skip_index_t *index, const size_t position);
+
+/**
+ * @brief Record that all links except the sentinel have been removed.
+ * @param index The index.
+ **/
+void skip_index_clear(skip_index_t *index);
+
+/**
+ * @brief Report a change to the chain that was not recorded, so that the index is rebuilt on its next use.
+ * @param index The index.
+ **/
+void skip_index_invalidate(skip_index_t *index);
@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "thread_pool.h"
+
+/**
+ * @file thread_pool.c
+ * @brief Implementation of the pool of worker threads.
+ *
+ * The thread running a task publishes it under the lock of the pool and bumps
+ * the generation, which wakes the workers. Every worker that sees the new
+ * generation registers as busy and claims chunks from a shared counter. Once
+ * the calling thread runs out of chunks it withdraws the task, so that workers
+ * that wake up late do not see it, and waits until no worker is busy.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Task being run by a pool.
+typedef struct job
+{
+  chunk_function task;  // Function run for every chunk.
+  void *arg;            // Argument of the task.
+  size_t chunks;        // Number of chunks.
+  atomic_size_t next;   // Next chunk to claim.
+} job_t;
+
+/// Pool of worker threads.
+struct thread_pool
+{
+  pthread_t *threads;         // Worker threads.
+  size_t workers;             // Number of worker threads.
+  pthread_mutex_t run_lock;   // Held while a task runs, so that tasks run one after the other.
+  pthread_mutex_t lock;       // Guards the fields below.
+  pthread_cond_t wake;        // Signalled when a task is published or the pool stops.
+  pthread_cond_t idle;        // Signalled when the last busy worker finishes.
+  job_t *job;                 // Task being run, or NULL.
+  unsigned long generation;   // Number of tasks published so far.
+  size_t busy;                // Number of workers taking part in the task.
+  bool stopping;              // True once the pool is being destroyed.
+};
+
+/**
+ * @brief Claim and run chunks of a task until none are left.
+ * @param job The task.
+ **/
+static void thread_pool_inner_work(job_t *job);
+
+/**
+ * @brief Main function of a worker thread.
+ * @param arg The pool.
+ * @return NULL.
+ **/
+static void *thread_pool_inner_main(void *arg);
+
+/**
+ * @brief Stop the first workers of a pool and free it.
+ * @param pool The pool.
+ * @param started The number of workers that were started.
+ **/
+static void thread_pool_inner_stop(thread_pool_t *pool, const size_t started);
+
+/**
+ * @brief Claim and run chunks of a task until none are left.
+ * @param job The task.
+ **/
+static void thread_pool_inner_work(job_t *job)
+{
+  for (size_t chunk = atomic_fetch_add(&job->next, 1); chunk < job->chunks;
+       chunk = atomic_fetch_add(&job->next, 1))
+    {
+      job->task(job->arg, chunk);
+    }
+}
+
+/**
+ * @brief Main function of a worker thread.
+ * @param arg The pool.
+ * @return NULL.
+ **/
+static void *thread_pool_inner_main(void *arg)
+{
+  thread_pool_t *pool = arg;
+  unsigned long seen = 0;
+  pthread_mutex_lock(&pool->lock);
+  while (true)
+    {
+      while (!pool->stopping && (pool->job == NULL || pool->generation == seen))
+        {
+          pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+      if (pool->stopping)
+        {
+          break;
+        }
+      seen = pool->generation;
+      job_t *job = pool->job;
+      pool->busy += 1;
+      pthread_mutex_unlock(&pool->lock);
+
+      thread_pool_inner_work(job);
+
+      pthread_mutex_lock(&pool->lock);
+      pool->busy -= 1;
+      if (pool->busy == 0)
+        {
+          pthread_cond_broadcast(&pool->idle);
+        }
+    }
+  pthread_mutex_unlock(&pool->lock);
+
+  return NULL;
+}
+
+/**
+ * @brief Stop the first workers of a pool and free it.
+ * @param pool The pool.
+ * @param started The number of workers that were started.
+ **/
+static void thread_pool_inner_stop(thread_pool_t *pool, const size_t started)
+{
+  pthread_mutex_lock(&pool->lock);
+  pool->stopping = true;
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+  for (size_t i = 0; i < started; ++i)
+    {
+      pthread_join(pool->threads[i], NULL);
+    }
+  pthread_cond_destroy(&pool->idle);
+  pthread_cond_destroy(&pool->wake);
+  pthread_mutex_destroy(&pool->lock);
+  pthread_mutex_destroy(&pool->run_lock);
+  free(pool->threads);
+  free(pool);
+}
+
+thread_pool_t *thread_pool_create(const size_t workers)
+{
+  thread_pool_t *pool = calloc(1, sizeof(thread_pool_t));
+  if (pool == NULL)
+    {
+      puts("Failed to allocate memory for a thread pool.");
+      return NULL;
+    }
+  pool->workers = workers;
+  if (workers == 0)
+    {
+      const long processors = sysconf(_SC_NPROCESSORS_ONLN);
+      pool->workers = processors > 1 ? (size_t)processors - 1 : 0;
+    }
+  pool->threads = calloc(pool->workers ? pool->workers : 1, sizeof(pthread_t));
+  if (pool->threads == NULL)
+    {
+      puts("Failed to allocate memory for a thread pool.");
+      free(pool);
+      return NULL;
+    }
+  pthread_mutex_init(&pool->run_lock, NULL);
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->wake, NULL);
+  pthread_cond_init(&pool->idle, NULL);
+
+  for (size_t i = 0; i < pool->workers; ++i)
+    {
+      if (pthread_create(&pool->threads[i], NULL, thread_pool_inner_main, pool) != 0)
+        {
+          puts("Failed to start a worker thread.");
+          thread_pool_inner_stop(pool, i);
+          return NULL;
+        }
+    }
+
+  return pool;
+}
+
+void thread_pool_destroy(thread_pool_t *pool)
+{
+  thread_pool_inner_stop(pool, pool->workers);
+}
+
+size_t thread_pool_threads(thread_pool_t *pool)
+{
+  return pool->workers + 1;
+}
+
+void thread_pool_run(thread_pool_t *pool, chunk_function task, void *arg, const size_t chunks)
+{
+  job_t job = { .task = task, .arg = arg, .chunks = chunks };
+  atomic_init(&job.next, 0);
+  if (pool->workers == 0 || chunks <= 1)
+    {
+      thread_pool_inner_work(&job);
+      return;
+    }
+
+  pthread_mutex_lock(&pool->run_lock);
+  pthread_mutex_lock(&pool->lock);
+  pool->job = &job;
+  pool->generation += 1;
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+
+  thread_pool_inner_work(&job);
+
+  pthread_mutex_lock(&pool->lock);
+  pool->job = NULL;
+  while (pool->busy > 0)
+    {
+      pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+  pthread_mutex_unlock(&pool->lock);
+  pthread_mutex_unlock(&pool->run_lock);
+}
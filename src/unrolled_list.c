@@ -0,0 +1,733 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "list_engine.h"
+
+/**
+ * @file unrolled_list.c
+ * @brief Unrolled storage engine for linked lists.
+ *
+ * This file implements a storage engine that keeps the elements of a list in
+ * a chain of nodes, where each node holds a cache line worth of elements.
+ * Scans touch one node per cache line of elements rather than one link per
+ * element, and only one pointer is stored per node. All nodes except the last
+ * one are non-empty, and the chain always has at least one node.
+ *
+ * @date 2026-10-16
+ * @version 1.0
+ **/
+
+/// Number of elements stored in each node, filling one 64 byte cache line.
+#define UNROLLED_NODE_CAPACITY (64 / sizeof(elem_t))
+
+/// Node holding a block of elements.
+typedef struct unrolled_node unrolled_node_t;
+
+/// Node holding a block of elements.
+struct unrolled_node
+{
+  unrolled_node_t *next;                   // Next node.
+  size_t count;                            // Number of elements used in the block.
+  elem_t elements[UNROLLED_NODE_CAPACITY]; // Block of elements.
+};
+
+/// Storage of an unrolled list.
+typedef struct unrolled_store
+{
+  unrolled_node_t *head;  // First node.
+  unrolled_node_t *tail;  // Last node.
+} unrolled_store_t;
+
+/**
+ * @brief Create a new empty node.
+ * @param next The next node.
+ * @return A pointer to the newly created node, or NULL if memory allocation failed.
+ **/
+static unrolled_node_t *unrolled_inner_node_new(unrolled_node_t *next);
+
+/**
+ * @brief Split a full node in two halves, keeping the lower half in place.
+ * @param store The storage the node belongs to.
+ * @param node The node to split.
+ * @return True if the node was split, false if memory allocation failed.
+ **/
+static bool unrolled_inner_split(unrolled_store_t *store, unrolled_node_t *node);
+
+/**
+ * @brief Insert an element at a position within a node, splitting it if it is full.
+ * @param store The storage the node belongs to.
+ * @param node The node to insert into, updated to the node holding the element.
+ * @param offset The position within the node, updated to the position of the element.
+ * @param value The element to insert.
+ * @return True if the element was inserted, false if memory allocation failed.
+ **/
+static bool unrolled_inner_insert_at(unrolled_store_t *store, unrolled_node_t **node, size_t *offset, const elem_t value);
+
+/**
+ * @brief Remove an element at a position within a node, merging it with its successor when both fit in one node.
+ * @param store The storage the node belongs to.
+ * @param node The node to remove from.
+ * @param offset The position within the node.
+ * @return The removed element.
+ **/
+static elem_t unrolled_inner_remove_at(unrolled_store_t *store, unrolled_node_t *node, const size_t offset);
+
+/**
+ * @brief Find the node holding the element at an index.
+ * @param store The storage to search.
+ * @param index The index, updated to the position within the returned node.
+ * @return The node holding the element, or the last node if index equals the number of elements.
+ **/
+static unrolled_node_t *unrolled_inner_find(unrolled_store_t *store, size_t *index);
+
+/**
+ * @brief Move an iterator past exhausted nodes so that it refers to an element if there is one.
+ * @param iter The iterator.
+ **/
+static void unrolled_inner_normalize(list_iterator_t *iter);
+
+/**
+ * @brief Create a new empty node.
+ * @param next The next node.
+ * @return A pointer to the newly created node, or NULL if memory allocation failed.
+ **/
+static unrolled_node_t *unrolled_inner_node_new(unrolled_node_t *next)
+{
+  unrolled_node_t *new = malloc(sizeof(unrolled_node_t));
+  if (new == NULL)
+    {
+      puts("Failed to allocate memory for another node.");
+      return NULL;
+    }
+  new->next = next;
+  new->count = 0;
+
+  return new;
+}
+
+/**
+ * @brief Split a full node in two halves, keeping the lower half in place.
+ * @param store The storage the node belongs to.
+ * @param node The node to split.
+ * @return True if the node was split, false if memory allocation failed.
+ **/
+static bool unrolled_inner_split(unrolled_store_t *store, unrolled_node_t *node)
+{
+  unrolled_node_t *upper = unrolled_inner_node_new(node->next);
+  if (upper == NULL)
+    {
+      return false;
+    }
+  const size_t keep = node->count / 2;
+  upper->count = node->count - keep;
+  memcpy(upper->elements, node->elements + keep, upper->count * sizeof(elem_t));
+  node->count = keep;
+  node->next = upper;
+  if (store->tail == node)
+    {
+      store->tail = upper;
+    }
+
+  return true;
+}
+
+/**
+ * @brief Insert an element at a position within a node, splitting it if it is full.
+ * @param store The storage the node belongs to.
+ * @param node The node to insert into, updated to the node holding the element.
+ * @param offset The position within the node, updated to the position of the element.
+ * @param value The element to insert.
+ * @return True if the element was inserted, false if memory allocation failed.
+ **/
+static bool unrolled_inner_insert_at(unrolled_store_t *store, unrolled_node_t **node, size_t *offset, const elem_t value)
+{
+  unrolled_node_t *target = *node;
+  size_t position = *offset;
+  if (target->count == UNROLLED_NODE_CAPACITY)
+    {
+      if (!unrolled_inner_split(store, target))
+        {
+          return false;
+        }
+      if (position > target->count)
+        {
+          position -= target->count;
+          target = target->next;
+        }
+    }
+  memmove(target->elements + position + 1, target->elements + position,
+          (target->count - position) * sizeof(elem_t));
+  target->elements[position] = value;
+  target->count += 1;
+  *node = target;
+  *offset = position;
+
+  return true;
+}
+
+/**
+ * @brief Remove an element at a position within a node, merging it with its successor when both fit in one node.
+ * @param store The storage the node belongs to.
+ * @param node The node to remove from.
+ * @param offset The position within the node.
+ * @return The removed element.
+ **/
+static elem_t unrolled_inner_remove_at(unrolled_store_t *store, unrolled_node_t *node, const size_t offset)
+{
+  const elem_t value_removed = node->elements[offset];
+  node->count -= 1;
+  memmove(node->elements + offset, node->elements + offset + 1,
+          (node->count - offset) * sizeof(elem_t));
+
+  unrolled_node_t *next = node->next;
+  if (next != NULL && node->count + next->count <= UNROLLED_NODE_CAPACITY)
+    {
+      memcpy(node->elements + node->count, next->elements, next->count * sizeof(elem_t));
+      node->count += next->count;
+      node->next = next->next;
+      if (store->tail == next)
+        {
+          store->tail = node;
+        }
+      free(next);
+    }
+
+  return value_removed;
+}
+
+/**
+ * @brief Find the node holding the element at an index.
+ * @param store The storage to search.
+ * @param index The index, updated to the position within the returned node.
+ * @return The node holding the element, or the last node if index equals the number of elements.
+ **/
+static unrolled_node_t *unrolled_inner_find(unrolled_store_t *store, size_t *index)
+{
+  unrolled_node_t *node = store->head;
+  while (*index >= node->count && node->next != NULL)
+    {
+      *index -= node->count;
+      node = node->next;
+    }
+
+  return node;
+}
+
+/**
+ * @brief Move an iterator past exhausted nodes so that it refers to an element if there is one.
+ * @param iter The iterator.
+ **/
+static void unrolled_inner_normalize(list_iterator_t *iter)
+{
+  unrolled_node_t *node = iter->node;
+  while (iter->offset == node->count && node->next != NULL)
+    {
+      node = node->next;
+      iter->offset = 0;
+    }
+  iter->node = node;
+}
+
+static bool unrolled_create(list_t *list)
+{
+  unrolled_store_t *store = calloc(1, sizeof(unrolled_store_t));
+  if (store == NULL)
+    {
+      puts("Failed to allocate memory for an unrolled list.");
+      return false;
+    }
+  store->head = store->tail = unrolled_inner_node_new(NULL);
+  if (store->head == NULL)
+    {
+      free(store);
+      return false;
+    }
+  list->store = store;
+
+  return true;
+}
+
+static void unrolled_clear(list_t *list)
+{
+  unrolled_store_t *store = list->store;
+  for (const unrolled_node_t *node = store->head; node && list->destructor; node = node->next)
+    {
+      for (size_t i = 0; i < node->count; ++i)
+        {
+          list->destructor(node->elements[i]);
+        }
+    }
+  unrolled_node_t *node = store->head->next;
+  while (node != NULL)
+    {
+      unrolled_node_t *next = node->next;
+      free(node);
+      node = next;
+    }
+  store->head->next = NULL;
+  store->head->count = 0;
+  store->tail = store->head;
+  list->size = 0;
+}
+
+static void unrolled_destroy(list_t *list)
+{
+  unrolled_store_t *store = list->store;
+  unrolled_clear(list);
+  free(store->head);
+  free(store);
+}
+
+static bool unrolled_append(list_t *list, const elem_t value)
+{
+  unrolled_store_t *store = list->store;
+  unrolled_node_t *tail = store->tail;
+  if (tail->count == UNROLLED_NODE_CAPACITY)
+    {
+      tail = unrolled_inner_node_new(NULL);
+      if (tail == NULL)
+        {
+          puts("Append failed due to memory corruption!");
+          return false;
+        }
+      store->tail->next = tail;
+      store->tail = tail;
+    }
+  tail->elements[tail->count] = value;
+  tail->count += 1;
+  list->size += 1;
+
+  return true;
+}
+
+static bool unrolled_prepend(list_t *list, const elem_t value)
+{
+  unrolled_store_t *store = list->store;
+  if (store->head->count == UNROLLED_NODE_CAPACITY)
+    {
+      unrolled_node_t *head = unrolled_inner_node_new(store->head);
+      if (head == NULL)
+        {
+          puts("Prepend failed due to memory corruption!");
+          return false;
+        }
+      store->head = head;
+    }
+  unrolled_node_t *node = store->head;
+  size_t offset = 0;
+  unrolled_inner_insert_at(store, &node, &offset, value);
+  list->size += 1;
+
+  return true;
+}
+
+static bool unrolled_insert(list_t *list, const size_t index, const elem_t value)
+{
+  unrolled_store_t *store = list->store;
+  size_t offset = index;
+  unrolled_node_t *node = unrolled_inner_find(store, &offset);
+  if (!unrolled_inner_insert_at(store, &node, &offset, value))
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  list->size += 1;
+
+  return true;
+}
+
+static elem_t unrolled_remove(list_t *list, const size_t index)
+{
+  unrolled_store_t *store = list->store;
+  size_t offset = index;
+  unrolled_node_t *node = unrolled_inner_find(store, &offset);
+  list->size -= 1;
+
+  return unrolled_inner_remove_at(store, node, offset);
+}
+
+static elem_t unrolled_get(list_t *list, const size_t index)
+{
+  size_t offset = index;
+  unrolled_node_t *node = unrolled_inner_find(list->store, &offset);
+
+  return node->elements[offset];
+}
+
+/// Scan every node for an element, comparing a whole node without branches so that the loop can be vectorised.
+#define UNROLLED_SCAN(store, element, member)                                  \
+  for (const unrolled_node_t *node = (store)->head; node; node = node->next)  \
+    {                                                                          \
+      bool found = false;                                                      \
+      for (size_t i = 0; i < node->count; ++i)                                 \
+        {                                                                      \
+          found |= node->elements[i].member == (element).member;               \
+        }                                                                      \
+      if (found)                                                               \
+        {                                                                      \
+          return true;                                                         \
+        }                                                                      \
+    }                                                                          \
+  return false
+
+static bool unrolled_contains(list_t *list, const elem_t element)
+{
+  const unrolled_store_t *store = list->store;
+  switch (list->eq_kind)
+    {
+    case LIST_EQ_INT: UNROLLED_SCAN(store, element, i);
+    case LIST_EQ_UNSIGNED: UNROLLED_SCAN(store, element, u);
+    case LIST_EQ_BOOL: UNROLLED_SCAN(store, element, b);
+    case LIST_EQ_FLOAT: UNROLLED_SCAN(store, element, f);
+    case LIST_EQ_POINTER: UNROLLED_SCAN(store, element, p);
+    case LIST_EQ_CUSTOM: break;
+    }
+  for (const unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      for (size_t i = 0; i < node->count; ++i)
+        {
+          if (list->fun(node->elements[i], element))
+            {
+              return true;
+            }
+        }
+    }
+  return false;
+}
+
+static bool unrolled_all(list_t *list, predicate prop, const void *extra)
+{
+  const unrolled_store_t *store = list->store;
+  size_t calls = 0;
+  size_t nodes = 0;
+  for (const unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      ++nodes;
+      for (size_t i = 0; i < node->count; ++i)
+        {
+          ++calls;
+          if (!prop(node->elements[i], extra))
+            {
+              LIST_COUNT(list, calls, nodes);
+              return false;
+            }
+        }
+    }
+  LIST_COUNT(list, calls, nodes);
+  return true;
+}
+
+static bool unrolled_any(list_t *list, predicate prop, const void *extra)
+{
+  const unrolled_store_t *store = list->store;
+  size_t calls = 0;
+  size_t nodes = 0;
+  for (const unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      ++nodes;
+      for (size_t i = 0; i < node->count; ++i)
+        {
+          ++calls;
+          if (prop(node->elements[i], extra))
+            {
+              LIST_COUNT(list, calls, nodes);
+              return true;
+            }
+        }
+    }
+  LIST_COUNT(list, calls, nodes);
+  return false;
+}
+
+static void unrolled_apply_to_all(list_t *list, apply_function fun, const void *extra)
+{
+  unrolled_store_t *store = list->store;
+  for (unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      for (size_t i = 0; i < node->count; ++i)
+        {
+          fun(&node->elements[i], extra);
+        }
+    }
+}
+
+static size_t unrolled_split(list_t *list, list_chunk_t *chunks, const size_t count)
+{
+  const unrolled_store_t *store = list->store;
+  unrolled_node_t *node = store->head;
+  size_t offset = 0;
+  size_t start = 0;
+  for (size_t i = 0; i < count; ++i)
+    {
+      const size_t end = (i + 1) * list->size / count;
+      if (offset == node->count)
+        {
+          node = node->next;
+          offset = 0;
+        }
+      chunks[i] = (list_chunk_t) { .node = node, .offset = offset, .length = end - start };
+      for (size_t left = end - start; left > 0;)
+        {
+          if (offset == node->count)
+            {
+              node = node->next;
+              offset = 0;
+            }
+          const size_t step = node->count - offset < left ? node->count - offset : left;
+          offset += step;
+          left -= step;
+        }
+      start = end;
+    }
+  return count;
+}
+
+static elem_t *unrolled_chunk_next(list_chunk_t *chunk)
+{
+  if (chunk->length == 0)
+    {
+      return NULL;
+    }
+  unrolled_node_t *node = chunk->node;
+  if (chunk->offset == node->count)
+    {
+      node = node->next;
+      chunk->node = node;
+      chunk->offset = 0;
+      chunk->nodes += 1;
+    }
+  else if (chunk->nodes == 0)
+    {
+      chunk->nodes = 1;
+    }
+  chunk->length -= 1;
+  return &node->elements[chunk->offset++];
+}
+
+static bool unrolled_sort(list_t *list, cmp_function cmp)
+{
+  const size_t size = list->size;
+  if (size < 2)
+    {
+      return true;
+    }
+  elem_t *from = malloc(2 * size * sizeof(elem_t));
+  if (from == NULL)
+    {
+      return false;
+    }
+  const unrolled_store_t *store = list->store;
+  size_t position = 0;
+  for (const unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      memcpy(&from[position], node->elements, node->count * sizeof(elem_t));
+      position += node->count;
+    }
+
+  // Merge runs of width elements pairwise into the other half of the buffer, doubling the width on every pass.
+  elem_t *buffer = from;
+  elem_t *to = from + size;
+  for (size_t width = 1; width < size; width *= 2)
+    {
+      for (size_t low = 0; low < size; low += 2 * width)
+        {
+          const size_t middle = low + width < size ? low + width : size;
+          const size_t high = middle + width < size ? middle + width : size;
+          size_t left = low;
+          size_t right = middle;
+          for (size_t out = low; out < high; ++out)
+            {
+              const bool take_right = right < high && (left == middle || cmp(from[right], from[left]) < 0);
+              to[out] = take_right ? from[right++] : from[left++];
+            }
+        }
+      elem_t *swap = from;
+      from = to;
+      to = swap;
+    }
+
+  position = 0;
+  for (unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      memcpy(node->elements, &from[position], node->count * sizeof(elem_t));
+      position += node->count;
+    }
+  free(buffer);
+  return true;
+}
+
+static size_t unrolled_filter(list_t *list, predicate prop, const void *extra, const bool matching)
+{
+  // Compact the kept elements towards the head, writing never ahead of reading.
+  unrolled_store_t *store = list->store;
+  unrolled_node_t *out = store->head;
+  size_t kept = 0;
+  size_t removed = 0;
+  for (unrolled_node_t *node = store->head; node; node = node->next)
+    {
+      const size_t count = node->count;
+      for (size_t i = 0; i < count; ++i)
+        {
+          const elem_t value = node->elements[i];
+          if (prop(value, extra) == matching)
+            {
+              if (list->destructor != NULL)
+                {
+                  list->destructor(value);
+                }
+              ++removed;
+              continue;
+            }
+          if (kept == UNROLLED_NODE_CAPACITY)
+            {
+              out->count = kept;
+              out = out->next;
+              kept = 0;
+            }
+          out->elements[kept++] = value;
+        }
+    }
+  out->count = kept;
+  unrolled_node_t *node = out->next;
+  out->next = NULL;
+  store->tail = out;
+  while (node != NULL)
+    {
+      unrolled_node_t *next = node->next;
+      free(node);
+      node = next;
+    }
+  list->size -= removed;
+
+  return removed;
+}
+
+static void unrolled_iterator_reset(list_iterator_t *iter)
+{
+  const unrolled_store_t *store = iter->list->store;
+  iter->node = store->head;
+  iter->offset = 0;
+  unrolled_inner_normalize(iter);
+}
+
+static bool unrolled_iterator_has_next(list_iterator_t *iter)
+{
+  const unrolled_node_t *node = iter->node;
+  return iter->offset < node->count;
+}
+
+static elem_t unrolled_iterator_next(list_iterator_t *iter)
+{
+  const unrolled_node_t *node = iter->node;
+  const elem_t value = node->elements[iter->offset];
+  iter->offset += 1;
+  unrolled_inner_normalize(iter);
+
+  return value;
+}
+
+static elem_t unrolled_iterator_remove(list_iterator_t *iter)
+{
+  if (!unrolled_iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  const elem_t value_removed = unrolled_inner_remove_at(iter->list->store, iter->node, iter->offset);
+  iter->list->size -= 1;
+  unrolled_inner_normalize(iter);
+
+  return value_removed;
+}
+
+static bool unrolled_iterator_insert(list_iterator_t *iter, const elem_t element)
+{
+  unrolled_node_t *node = iter->node;
+  if (!unrolled_inner_insert_at(iter->list->store, &node, &iter->offset, element))
+    {
+      puts("Insertion failed due to memory corruption!");
+      return false;
+    }
+  iter->node = node;
+  iter->list->size += 1;
+
+  return true;
+}
+
+static elem_t unrolled_iterator_current(list_iterator_t *iter)
+{
+  if (!unrolled_iterator_has_next(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  const unrolled_node_t *node = iter->node;
+  return node->elements[iter->offset];
+}
+
+static bool unrolled_iterator_has_previous(list_iterator_t *iter)
+{
+  const unrolled_store_t *store = iter->list->store;
+  return iter->offset > 0 || iter->node != store->head;
+}
+
+static elem_t unrolled_iterator_previous(list_iterator_t *iter)
+{
+  if (!unrolled_iterator_has_previous(iter))
+    {
+      elem_t result = {.i = -1};
+      return result;
+    }
+  if (iter->offset == 0)
+    {
+      // Only the tail may be empty, so the node preceding any other node holds elements.
+      const unrolled_store_t *store = iter->list->store;
+      unrolled_node_t *node = store->head;
+      while (node->next != iter->node)
+        {
+          node = node->next;
+        }
+      iter->node = node;
+      iter->offset = node->count;
+    }
+  const unrolled_node_t *node = iter->node;
+  iter->offset -= 1;
+
+  return node->elements[iter->offset];
+}
+
+static void unrolled_iterator_to_end(list_iterator_t *iter)
+{
+  const unrolled_store_t *store = iter->list->store;
+  iter->node = store->tail;
+  iter->offset = store->tail->count;
+}
+
+const list_engine_t unrolled_engine =
+  {
+    .create = unrolled_create,
+    .destroy = unrolled_destroy,
+    .append = unrolled_append,
+    .prepend = unrolled_prepend,
+    .insert = unrolled_insert,
+    .remove = unrolled_remove,
+    .get = unrolled_get,
+    .contains = unrolled_contains,
+    .clear = unrolled_clear,
+    .all = unrolled_all,
+    .any = unrolled_any,
+    .apply_to_all = unrolled_apply_to_all,
+    .iterator_reset = unrolled_iterator_reset,
+    .iterator_has_next = unrolled_iterator_has_next,
+    .iterator_next = unrolled_iterator_next,
+    .iterator_remove = unrolled_iterator_remove,
+    .iterator_insert = unrolled_iterator_insert,
+    .iterator_current = unrolled_iterator_current,
+    .iterator_has_previous = unrolled_iterator_has_previous,
+    .iterator_previous = unrolled_iterator_previous,
+    .iterator_to_end = unrolled_iterator_to_end,
+    .split = unrolled_split,
+    .chunk_next = unrolled_chunk_next,
+    .sort = unrolled_sort,
+    .filter = unrolled_filter,
+  };
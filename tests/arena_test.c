@@ -0,0 +1,90 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdbool.h>
+#include <CUnit/Basic.h>
+#include "arena.h"
+
+void test_arena_create_destroy()
+{
+  arena_t *arena = arena_create(0);
+  CU_ASSERT_PTR_NOT_NULL(arena);
+  arena_destroy(arena);
+}
+
+void test_arena_alloc_aligned()
+{
+  arena_t *arena = arena_create(256);
+  char *previous = NULL;
+  for (size_t size = 0; size < 100; ++size)
+    {
+      char *object = arena_alloc(arena, size);
+      CU_ASSERT_PTR_NOT_NULL(object);
+      CU_ASSERT((uintptr_t)object % _Alignof(max_align_t) == 0);
+      CU_ASSERT(object != previous);
+      memset(object, (int)size, size);
+      previous = object;
+    }
+  arena_destroy(arena);
+}
+
+void test_arena_large_objects()
+{
+  arena_t *arena = arena_create(256);
+  int *small = arena_alloc(arena, sizeof(int));
+  *small = 7;
+  char *large = arena_alloc(arena, 10000);
+  CU_ASSERT_PTR_NOT_NULL(large);
+  memset(large, 1, 10000);
+  int *next = arena_alloc(arena, sizeof(int));
+  *next = 8;
+  // A large object does not interrupt the block that small objects are carved from.
+  CU_ASSERT((char *)next - (char *)small < 256);
+  CU_ASSERT(*small == 7);
+  // Sizes that would wrap around when rounded up are refused.
+  CU_ASSERT_PTR_NULL(arena_alloc(arena, SIZE_MAX));
+  CU_ASSERT_PTR_NULL(arena_alloc(arena, SIZE_MAX - 8));
+  CU_ASSERT_PTR_NULL(arena_create(SIZE_MAX));
+  CU_ASSERT_PTR_NOT_NULL(arena_alloc(arena, sizeof(int)));
+  arena_destroy(arena);
+}
+
+void test_arena_reset_reuse()
+{
+  arena_t *arena = arena_create(1024);
+  void *first = NULL;
+  for (int round = 0; round < 3; ++round)
+    {
+      void *object = arena_alloc(arena, 16);
+      CU_ASSERT(round == 0 || object == first);
+      first = object;
+      for (int i = 0; i < 1000; ++i)
+        {
+          CU_ASSERT_PTR_NOT_NULL(arena_alloc(arena, 24));
+        }
+      CU_ASSERT_PTR_NOT_NULL(arena_alloc(arena, 5000));
+      arena_reset(arena);
+    }
+  arena_reset(arena);
+  arena_destroy(arena);
+}
+
+int main()
+{
+  if (CUE_SUCCESS != CU_initialize_registry())
+    return CU_get_error();
+
+  CU_pSuite allocation = CU_add_suite("Allocation", NULL, NULL);
+
+  CU_add_test(allocation, "Arena Creation", test_arena_create_destroy);
+  CU_add_test(allocation, "Aligned Objects", test_arena_alloc_aligned);
+  CU_add_test(allocation, "Large Objects", test_arena_large_objects);
+  CU_add_test(allocation, "Reset And Reuse", test_arena_reset_reuse);
+
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  CU_cleanup_registry();
+
+  return CU_get_error();
+}
@@ -0,0 +1,262 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <CUnit/Basic.h>
+#include "concurrent_list.h"
+
+/// Number of threads of every kind in the stress tests.
+#define STRESS_THREADS 4
+/// Number of elements added by every producer in the stress tests.
+#define STRESS_ELEMENTS 5000
+
+static bool compare_int_elements(elem_t a, elem_t b)
+{
+  return a.i == b.i;
+}
+
+static bool is_positive(const elem_t value, const void *extra)
+{
+  (void)extra;
+  return value.i > 0;
+}
+
+static void add(elem_t *value, const void *extra)
+{
+  value->i += *(const int *)extra;
+}
+
+void test_create_destroy()
+{
+  concurrent_list_t *list = concurrent_list_create(compare_int_elements);
+  CU_ASSERT_PTR_NOT_NULL(list);
+  CU_ASSERT(concurrent_list_is_empty(list));
+  concurrent_list_destroy(list);
+}
+
+void test_sequential_operations()
+{
+  concurrent_list_t *list = concurrent_list_create(compare_int_elements);
+  elem_t value = int_elem(0);
+  CU_ASSERT_FALSE(concurrent_list_pop_front(list, &value));
+  CU_ASSERT_FALSE(concurrent_list_get(list, 0, &value));
+  concurrent_list_append(list, int_elem(2));
+  concurrent_list_prepend(list, int_elem(1));
+  concurrent_list_append(list, int_elem(4));
+  CU_ASSERT(concurrent_list_insert(list, 2, int_elem(3)));
+  CU_ASSERT(concurrent_list_insert(list, 4, int_elem(5)));
+  CU_ASSERT_FALSE(concurrent_list_insert(list, 6, int_elem(7)));
+  CU_ASSERT_FALSE(concurrent_list_insert(list, -1, int_elem(7)));
+  CU_ASSERT(concurrent_list_size(list) == 5);
+  for (int i = 0; i < 5; ++i)
+    {
+      CU_ASSERT(concurrent_list_get(list, i, &value) && value.i == i + 1);
+    }
+  CU_ASSERT(concurrent_list_contains(list, int_elem(5)));
+  CU_ASSERT_FALSE(concurrent_list_contains(list, int_elem(6)));
+  CU_ASSERT(concurrent_list_all(list, is_positive, NULL));
+  const int step = -3;
+  concurrent_list_apply_to_all(list, add, &step);
+  CU_ASSERT_FALSE(concurrent_list_all(list, is_positive, NULL));
+  CU_ASSERT(concurrent_list_any(list, is_positive, NULL));
+
+  // Removing the last element must keep appends working.
+  CU_ASSERT(concurrent_list_remove(list, 4, &value) && value.i == 2);
+  CU_ASSERT_FALSE(concurrent_list_remove(list, 4, &value));
+  concurrent_list_append(list, int_elem(9));
+  CU_ASSERT(concurrent_list_get(list, 4, &value) && value.i == 9);
+  CU_ASSERT(concurrent_list_pop_front(list, &value) && value.i == -2);
+  CU_ASSERT(concurrent_list_size(list) == 4);
+
+  concurrent_list_clear(list);
+  CU_ASSERT(concurrent_list_is_empty(list));
+  CU_ASSERT_FALSE(concurrent_list_any(list, is_positive, NULL));
+  concurrent_list_append(list, int_elem(1));
+  CU_ASSERT(concurrent_list_get(list, 0, &value) && value.i == 1);
+  concurrent_list_destroy(list);
+}
+
+/// Shared state of a stress test.
+typedef struct stress
+{
+  concurrent_list_t *list;
+  int id;                      // Index of the thread among threads of its kind.
+  atomic_int *seen;            // Number of times every element was removed.
+  atomic_bool *done;           // Set when all producers have finished.
+} stress_t;
+
+static void *produce(void *arg)
+{
+  stress_t *stress = arg;
+  for (int i = 0; i < STRESS_ELEMENTS; ++i)
+    {
+      const int value = stress->id * STRESS_ELEMENTS + i;
+      if (i % 3 == 0)
+        {
+          concurrent_list_prepend(stress->list, int_elem(value));
+        }
+      else if (i % 3 == 1)
+        {
+          concurrent_list_append(stress->list, int_elem(value));
+        }
+      else if (!concurrent_list_insert(stress->list, i % 7, int_elem(value)))
+        {
+          concurrent_list_append(stress->list, int_elem(value));
+        }
+    }
+  return NULL;
+}
+
+static void *consume(void *arg)
+{
+  stress_t *stress = arg;
+  elem_t value;
+  while (true)
+    {
+      const bool finished = atomic_load(stress->done);
+      bool removed = stress->id % 2 == 0
+        ? concurrent_list_pop_front(stress->list, &value)
+        : concurrent_list_remove(stress->list, (int)(concurrent_list_size(stress->list) / 2), &value);
+      if (!removed)
+        {
+          removed = concurrent_list_pop_front(stress->list, &value);
+        }
+      if (removed)
+        {
+          atomic_fetch_add(&stress->seen[value.i], 1);
+        }
+      else if (finished)
+        {
+          return NULL;
+        }
+    }
+}
+
+static void *read_list(void *arg)
+{
+  stress_t *stress = arg;
+  elem_t value;
+  while (!atomic_load(stress->done))
+    {
+      concurrent_list_contains(stress->list, int_elem(-1));
+      concurrent_list_any(stress->list, is_positive, NULL);
+      concurrent_list_get(stress->list, 3, &value);
+    }
+  return NULL;
+}
+
+void test_stress_producers_consumers()
+{
+  concurrent_list_t *list = concurrent_list_create(compare_int_elements);
+  atomic_int *seen = calloc(STRESS_THREADS * STRESS_ELEMENTS, sizeof(atomic_int));
+  atomic_bool done = false;
+  pthread_t producers[STRESS_THREADS];
+  pthread_t consumers[STRESS_THREADS];
+  pthread_t readers[STRESS_THREADS];
+  stress_t state[STRESS_THREADS];
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      state[t] = (stress_t) { .list = list, .id = t, .seen = seen, .done = &done };
+      pthread_create(&producers[t], NULL, produce, &state[t]);
+      pthread_create(&consumers[t], NULL, consume, &state[t]);
+      pthread_create(&readers[t], NULL, read_list, &state[t]);
+    }
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(producers[t], NULL);
+    }
+  atomic_store(&done, true);
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(consumers[t], NULL);
+      pthread_join(readers[t], NULL);
+    }
+
+  // Every element was removed exactly once, and the list is consistent afterwards.
+  int missing = 0;
+  for (int i = 0; i < STRESS_THREADS * STRESS_ELEMENTS; ++i)
+    {
+      missing += atomic_load(&seen[i]) != 1;
+    }
+  CU_ASSERT(missing == 0);
+  CU_ASSERT(concurrent_list_is_empty(list));
+  concurrent_list_append(list, int_elem(1));
+  concurrent_list_prepend(list, int_elem(0));
+  elem_t value;
+  CU_ASSERT(concurrent_list_get(list, 1, &value) && value.i == 1);
+  CU_ASSERT_FALSE(concurrent_list_get(list, 2, &value));
+  free(seen);
+  concurrent_list_destroy(list);
+}
+
+static void *append_and_clear(void *arg)
+{
+  stress_t *stress = arg;
+  for (int i = 0; i < STRESS_ELEMENTS; ++i)
+    {
+      concurrent_list_append(stress->list, int_elem(i + 1));
+      if (stress->id == 0 && i % 500 == 0)
+        {
+          concurrent_list_clear(stress->list);
+        }
+      else if (i % 5 == 0)
+        {
+          concurrent_list_remove(stress->list, i % 11, NULL);
+        }
+    }
+  return NULL;
+}
+
+void test_stress_clear()
+{
+  concurrent_list_t *list = concurrent_list_create(compare_int_elements);
+  atomic_bool done = false;
+  pthread_t writers[STRESS_THREADS];
+  pthread_t readers[STRESS_THREADS];
+  stress_t state[STRESS_THREADS];
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      state[t] = (stress_t) { .list = list, .id = t, .done = &done };
+      pthread_create(&writers[t], NULL, append_and_clear, &state[t]);
+      pthread_create(&readers[t], NULL, read_list, &state[t]);
+    }
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(writers[t], NULL);
+    }
+  atomic_store(&done, true);
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(readers[t], NULL);
+    }
+
+  size_t count = 0;
+  elem_t value;
+  while (concurrent_list_get(list, (int)count, &value))
+    {
+      ++count;
+    }
+  CU_ASSERT(count == concurrent_list_size(list));
+  CU_ASSERT(concurrent_list_all(list, is_positive, NULL));
+  concurrent_list_destroy(list);
+}
+
+int main()
+{
+  if (CUE_SUCCESS != CU_initialize_registry())
+    return CU_get_error();
+
+  CU_pSuite basics = CU_add_suite("Basics", NULL, NULL);
+  CU_pSuite stress = CU_add_suite("Stress", NULL, NULL);
+
+  CU_add_test(basics, "Create And Destroy", test_create_destroy);
+  CU_add_test(basics, "Sequential Operations", test_sequential_operations);
+  CU_add_test(stress, "Producers And Consumers", test_stress_producers_consumers);
+  CU_add_test(stress, "Clear Under Contention", test_stress_clear);
+
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  CU_cleanup_registry();
+
+  return CU_get_error();
+}
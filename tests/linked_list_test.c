@@ -1,6 +1,9 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <unistd.h>
 #include <CUnit/Basic.h>
 #include "linked_list.h"
 #include "iterator.h"
@@ -16,11 +19,30 @@ static bool compare_str_elements(elem_t a, elem_t b)
   return strcmp((char*)a.p, (char*)b.p) == 0;
 }
 
+static bool compare_int_elements_never(const elem_t a, const elem_t b)
+{
+  (void)a;
+  (void)b;
+  return false;
+}
+
+static size_t hash_int_element(elem_t value)
+{
+  return (size_t)value.i * 2654435761u;
+}
+
+static size_t hash_int_element_poorly(elem_t value)
+{
+  return (size_t)(value.i & 3);
+}
+
 static bool dummy_func_ptr(elem_t a, elem_t b)
 {
   return true;
 }
 
+void set_value(elem_t *value, const void *extra);
+
 static bool int_less(const elem_t element, const void *extra)
 {
   return element.i < *(int*)extra;
@@ -34,6 +56,444 @@ void test_create_destroy()
    linked_list_destroy(list);
 }
 
+void test_create_pooled()
+{
+  list_t *list = linked_list_create_pooled(compare_int_elements, NULL);
+  CU_ASSERT_PTR_NOT_NULL(list);
+  for (int i = 0; i < 100; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  CU_ASSERT(linked_list_remove(list, 50).i == 50);
+  linked_list_insert(list, 10, int_elem(-10));
+  CU_ASSERT(linked_list_get(list, 10).i == -10);
+  CU_ASSERT(linked_list_size(list) == 100);
+  linked_list_destroy(list);
+}
+
+void test_create_shared_pool()
+{
+  pool_t *pool = linked_list_pool_create(8);
+  list_t *first = linked_list_create_pooled(compare_int_elements, pool);
+  list_t *second = linked_list_create_pooled(compare_int_elements, pool);
+  for (int i = 0; i < 20; ++i)
+    {
+      linked_list_append(first, int_elem(i));
+      linked_list_prepend(second, int_elem(i));
+    }
+  linked_list_clear(first);
+  linked_list_append(second, int_elem(20));
+  CU_ASSERT(linked_list_size(first) == 0);
+  CU_ASSERT(linked_list_get(second, 0).i == 19);
+  CU_ASSERT(linked_list_get(second, 20).i == 20);
+  linked_list_destroy(first);
+  linked_list_destroy(second);
+  pool_destroy(pool);
+
+  pool = pool_create(sizeof(int), 0);
+  CU_ASSERT_PTR_NULL(linked_list_create_pooled(compare_int_elements, pool));
+  pool_destroy(pool);
+}
+
+void test_create_in_arena()
+{
+  arena_t *arena = arena_create(4096);
+  const list_options_t rejected[] = {
+    { .fun = compare_int_elements, .arena = arena, .private_pool = true },
+    { .fun = compare_int_elements, .arena = arena, .hash = hash_int_element },
+    { .fun = compare_int_elements, .arena = arena, .skip_index = true },
+    { .fun = compare_int_elements, .arena = arena, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .arena = arena, .layout = LIST_LAYOUT_ARRAY },
+    { .fun = compare_int_elements, .arena = arena, .layout = LIST_LAYOUT_COMPACT },
+  };
+  for (size_t o = 0; o < sizeof(rejected) / sizeof(rejected[0]); ++o)
+    {
+      CU_ASSERT_PTR_NULL(linked_list_create_with(&rejected[o]));
+    }
+
+  for (int request = 0; request < 3; ++request)
+    {
+      // Lists, links and iterators of one request all go away with a reset of the arena.
+      list_t *list = linked_list_create_in_arena(arena, compare_int_elements);
+      const list_options_t doubly = { .fun = compare_int_elements, .arena = arena, .doubly_linked = true };
+      list_t *other = linked_list_create_with(&doubly);
+      CU_ASSERT_PTR_NOT_NULL(list);
+      for (int i = 0; i < 1000; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+          linked_list_prepend(other, int_elem(i));
+        }
+      CU_ASSERT(linked_list_remove(list, 500).i == 500);
+      linked_list_insert(list, 500, int_elem(500));
+      CU_ASSERT(linked_list_pop_back(other).i == 0);
+      list_t *tail = linked_list_split_at(list, 600);
+      CU_ASSERT(linked_list_size(tail) == 400);
+      CU_ASSERT(linked_list_get(tail, 0).i == 600);
+      linked_list_concat(list, tail);
+      CU_ASSERT(linked_list_size(list) == 1000);
+      CU_ASSERT(linked_list_is_empty(tail));
+
+      list_iterator_t *iter = list_iterator(list);
+      for (int i = 0; i < 1000; ++i)
+        {
+          CU_ASSERT(iterator_next(iter).i == i);
+        }
+      iterator_destroy(iter);
+      list_iterator_t *backwards = list_iterator(other);
+      iterator_to_end(backwards);
+      CU_ASSERT(iterator_previous(backwards).i == 1);
+
+      // Cleared links are reused rather than taken from the arena again.
+      linked_list_clear(list);
+      for (int i = 0; i < 1000; ++i)
+        {
+          linked_list_append(list, int_elem(-i));
+        }
+      CU_ASSERT(linked_list_get(list, 999).i == -999);
+      CU_ASSERT(linked_list_calculate_size(list) == 1000);
+      if (request == 0)
+        {
+          linked_list_destroy(list);
+          linked_list_destroy(other);
+          linked_list_destroy(tail);
+        }
+      arena_reset(arena);
+    }
+  arena_destroy(arena);
+}
+
+void test_create_unrolled()
+{
+  const list_layout_t layouts[] = { LIST_LAYOUT_UNROLLED, LIST_LAYOUT_ARRAY, LIST_LAYOUT_COMPACT };
+  for (size_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); ++l)
+    {
+      const list_options_t options = { .fun = compare_int_elements, .layout = layouts[l] };
+      list_t *unrolled = linked_list_create_with(&options);
+      list_t *linked = linked_list_create(compare_int_elements);
+      CU_ASSERT_PTR_NOT_NULL(unrolled);
+      for (int i = 0; i < 100; ++i)
+        {
+          linked_list_append(unrolled, int_elem(i));
+          linked_list_append(linked, int_elem(i));
+          linked_list_prepend(unrolled, int_elem(-i));
+          linked_list_prepend(linked, int_elem(-i));
+          linked_list_insert(unrolled, (i * 7) % (int)linked_list_size(unrolled), int_elem(1000 + i));
+          linked_list_insert(linked, (i * 7) % (int)linked_list_size(linked), int_elem(1000 + i));
+        }
+      for (int i = 0; i < 150; ++i)
+        {
+          const int index = (i * 13) % (int)linked_list_size(linked);
+          CU_ASSERT(linked_list_remove(unrolled, index).i == linked_list_remove(linked, index).i);
+        }
+      CU_ASSERT(linked_list_size(unrolled) == linked_list_size(linked));
+      CU_ASSERT(linked_list_calculate_size(unrolled) == linked_list_size(linked));
+      for (int i = 0; i < (int)linked_list_size(linked); ++i)
+        {
+          CU_ASSERT(linked_list_get(unrolled, i).i == linked_list_get(linked, i).i);
+        }
+      CU_ASSERT(linked_list_contains(unrolled, linked_list_get(linked, 42)));
+      CU_ASSERT_FALSE(linked_list_contains(unrolled, int_elem(5000)));
+      linked_list_clear(unrolled);
+      CU_ASSERT(linked_list_is_empty(unrolled));
+      CU_ASSERT(linked_list_get(unrolled, 0).i == -1);
+      linked_list_destroy(unrolled);
+      linked_list_destroy(linked);
+
+      const list_options_t invalid = { .fun = compare_int_elements, .layout = layouts[l], .private_pool = true };
+      CU_ASSERT_PTR_NULL(linked_list_create_with(&invalid));
+    }
+}
+
+void test_unrolled_iterator()
+{
+  const list_layout_t layouts[] = { LIST_LAYOUT_UNROLLED, LIST_LAYOUT_ARRAY, LIST_LAYOUT_COMPACT };
+  for (size_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); ++l)
+    {
+      const list_options_t options = { .fun = compare_int_elements, .layout = layouts[l] };
+      list_t *list = linked_list_create_with(&options);
+      list_iterator_t *iter = list_iterator(list);
+      CU_ASSERT_FALSE(iterator_has_next(iter));
+      CU_ASSERT(iterator_current(iter).i == -1);
+      for (int i = 0; i < 40; ++i)
+        {
+          iterator_insert(iter, int_elem(i));
+          iterator_next(iter);
+        }
+      iterator_reset(iter);
+      for (int i = 0; i < 40; ++i)
+        {
+          CU_ASSERT(iterator_current(iter).i == i);
+          if (i % 2 == 0)
+            {
+              CU_ASSERT(iterator_remove(iter).i == i);
+            }
+          else
+            {
+              CU_ASSERT(iterator_next(iter).i == i);
+            }
+        }
+      CU_ASSERT_FALSE(iterator_has_next(iter));
+      iterator_reset(iter);
+      for (int i = 0; i < 20; ++i)
+        {
+          CU_ASSERT(iterator_next(iter).i == 2 * i + 1);
+        }
+      CU_ASSERT_FALSE(iterator_has_next(iter));
+      iterator_destroy(iter);
+      linked_list_destroy(list);
+    }
+}
+
+void test_compact_growth()
+{
+  // Slots never move, so an iterator survives growth of the arrays and reuse of released slots.
+  const list_options_t options = { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT };
+  list_t *list = linked_list_create_with(&options);
+  linked_list_append(list, int_elem(0));
+  linked_list_append(list, int_elem(1));
+  list_iterator_t *iter = list_iterator(list);
+  CU_ASSERT(iterator_next(iter).i == 0);
+  for (int i = 2; i < 10000; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+      if (i % 3 == 0)
+        {
+          CU_ASSERT(linked_list_pop_back(list).i == i);
+          linked_list_prepend(list, int_elem(-i));
+        }
+    }
+  CU_ASSERT(iterator_current(iter).i == 1);
+  CU_ASSERT(iterator_remove(iter).i == 1);
+  CU_ASSERT(iterator_current(iter).i == 2);
+  CU_ASSERT(linked_list_size(list) == 9999);
+  CU_ASSERT(linked_list_get(list, 0).i == -9999);
+  CU_ASSERT(linked_list_get(list, 3332).i == -3);
+  CU_ASSERT(linked_list_get(list, 3333).i == 0);
+  CU_ASSERT(linked_list_get(list, 3334).i == 2);
+  CU_ASSERT(linked_list_get(list, 9998).i == 9998);
+  iterator_destroy(iter);
+  linked_list_destroy(list);
+}
+
+void test_save_open_mmap()
+{
+  char path[] = "/tmp/linked_list_testXXXXXX";
+  const int fd = mkstemp(path);
+  CU_ASSERT(fd >= 0);
+  close(fd);
+  const list_layout_t layouts[] = { LIST_LAYOUT_LINKED, LIST_LAYOUT_UNROLLED, LIST_LAYOUT_ARRAY,
+                                    LIST_LAYOUT_COMPACT, LIST_LAYOUT_ADAPTIVE };
+  for (size_t l = 0; l < sizeof(layouts) / sizeof(layouts[0]); ++l)
+    {
+      const list_options_t options = { .eq_kind = LIST_EQ_INT, .layout = layouts[l] };
+      list_t *list = linked_list_create_with(&options);
+      for (int i = 0; i < 5000; ++i)
+        {
+          linked_list_append(list, int_elem(3 * i));
+        }
+      CU_ASSERT(linked_list_remove(list, 100).i == 300);
+      linked_list_prepend(list, int_elem(-3));
+      CU_ASSERT(linked_list_save(list, path));
+
+      // The built-in comparison is restored, so no eq_function is needed.
+      list_t *opened = linked_list_open_mmap(path, NULL);
+      CU_ASSERT_PTR_NOT_NULL(opened);
+      if (opened == NULL)
+        {
+          linked_list_destroy(list);
+          continue;
+        }
+      CU_ASSERT(linked_list_size(opened) == 5000);
+      CU_ASSERT(linked_list_contains(opened, int_elem(14997)));
+      CU_ASSERT_FALSE(linked_list_contains(opened, int_elem(300)));
+      for (int i = 0; i < 5000; ++i)
+        {
+          CU_ASSERT(linked_list_get(opened, i).i == linked_list_get(list, i).i);
+        }
+
+      // Changes stay private to the list, also once its storage moves to the heap.
+      CU_ASSERT(linked_list_pop_front(opened).i == -3);
+      linked_list_insert(opened, 100, int_elem(300));
+      for (int i = 5000; i < 6000; ++i)
+        {
+          linked_list_append(opened, int_elem(3 * i));
+        }
+      CU_ASSERT(linked_list_size(opened) == 6000);
+      for (int i = 0; i < 6000; ++i)
+        {
+          CU_ASSERT(linked_list_get(opened, i).i == 3 * i);
+        }
+      list_t *reopened = linked_list_open_mmap(path, NULL);
+      CU_ASSERT(linked_list_size(reopened) == 5000);
+      CU_ASSERT(linked_list_get(reopened, 0).i == -3);
+      CU_ASSERT(linked_list_get(reopened, 4999).i == 14997);
+      linked_list_destroy(reopened);
+      linked_list_destroy(opened);
+      linked_list_destroy(list);
+    }
+
+  list_t *empty = linked_list_create(compare_int_elements);
+  CU_ASSERT(linked_list_save(empty, path));
+  linked_list_destroy(empty);
+  empty = linked_list_open_mmap(path, compare_int_elements);
+  CU_ASSERT(linked_list_is_empty(empty));
+  CU_ASSERT_FALSE(linked_list_contains(empty, int_elem(0)));
+  linked_list_append(empty, int_elem(7));
+  CU_ASSERT(linked_list_contains(empty, int_elem(7)));
+  linked_list_destroy(empty);
+
+  FILE *file = fopen(path, "wb");
+  for (int i = 0; i < 100; ++i)
+    {
+      fputs("not a list ", file);
+    }
+  fclose(file);
+  CU_ASSERT_PTR_NULL(linked_list_open_mmap(path, compare_int_elements));
+  remove(path);
+  CU_ASSERT_PTR_NULL(linked_list_open_mmap(path, compare_int_elements));
+}
+
+/// Number of elements released by free_counted.
+static int released_elements = 0;
+
+static void free_counted(elem_t value)
+{
+  free(value.p);
+  ++released_elements;
+}
+
+void test_write_read_fd()
+{
+  char path[] = "/tmp/linked_list_testXXXXXX";
+  const int fd = mkstemp(path);
+  CU_ASSERT(fd >= 0);
+  arena_t *arena = arena_create(0);
+  const list_options_t options[] = {
+    { .eq_kind = LIST_EQ_INT },
+    { .eq_kind = LIST_EQ_INT, .doubly_linked = true, .skip_index = true, .hash = hash_int_element },
+    { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_UNROLLED },
+    { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_ARRAY },
+    { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_COMPACT },
+    { .eq_kind = LIST_EQ_INT, .layout = LIST_LAYOUT_ADAPTIVE },
+    { .eq_kind = LIST_EQ_INT, .arena = arena },
+  };
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      // Inserting in the middle leaves the gap of an array list there.
+      list_t *list = linked_list_create_with(&options[o]);
+      for (int i = 0; i < 10000; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+        }
+      linked_list_insert(list, 5000, int_elem(-1));
+      list_t *empty = linked_list_create_with(&options[o]);
+      CU_ASSERT(ftruncate(fd, 0) == 0);
+      CU_ASSERT(lseek(fd, 0, SEEK_SET) == 0);
+      CU_ASSERT(linked_list_write_fd(list, fd));
+      CU_ASSERT(linked_list_write_fd(empty, fd));
+      CU_ASSERT(linked_list_write_fd(list, fd));
+      CU_ASSERT(lseek(fd, 0, SEEK_SET) == 0);
+
+      // Lists follow each other in the stream, and can be read into any layout.
+      list_t *defaults = linked_list_read_fd(fd, NULL);
+      list_t *read_empty = linked_list_read_fd(fd, &options[o]);
+      list_t *same = linked_list_read_fd(fd, &options[o]);
+      CU_ASSERT_PTR_NULL(linked_list_read_fd(fd, NULL));
+      CU_ASSERT(linked_list_is_empty(read_empty));
+      CU_ASSERT(linked_list_size(defaults) == 10001);
+      CU_ASSERT(linked_list_size(same) == 10001);
+      CU_ASSERT(linked_list_calculate_size(defaults) == 10001);
+      CU_ASSERT(linked_list_contains(defaults, int_elem(-1)));
+      CU_ASSERT(linked_list_contains(same, int_elem(9999)));
+      CU_ASSERT_FALSE(linked_list_contains(same, int_elem(10000)));
+      list_iterator_t *expected = list_iterator(list);
+      list_iterator_t *first = list_iterator(defaults);
+      list_iterator_t *second = list_iterator(same);
+      while (iterator_has_next(expected))
+        {
+          const int value = iterator_next(expected).i;
+          CU_ASSERT(iterator_next(first).i == value);
+          CU_ASSERT(iterator_next(second).i == value);
+        }
+      CU_ASSERT_FALSE(iterator_has_next(first));
+      CU_ASSERT_FALSE(iterator_has_next(second));
+      CU_ASSERT(linked_list_get(same, 5000).i == -1);
+      CU_ASSERT(linked_list_pop_back(same).i == 9999);
+      iterator_destroy(expected);
+      iterator_destroy(first);
+      iterator_destroy(second);
+      linked_list_destroy(defaults);
+      linked_list_destroy(read_empty);
+      linked_list_destroy(same);
+      linked_list_destroy(empty);
+      linked_list_destroy(list);
+    }
+  arena_destroy(arena);
+
+  // A truncated stream yields no list.
+  CU_ASSERT(ftruncate(fd, 1000) == 0);
+  CU_ASSERT(lseek(fd, 0, SEEK_SET) == 0);
+  CU_ASSERT_PTR_NULL(linked_list_read_fd(fd, NULL));
+  close(fd);
+  remove(path);
+
+  // A pipe delivers the list through short reads and writes.
+  int ends[2];
+  CU_ASSERT(pipe(ends) == 0);
+  list_t *list = linked_list_create(compare_int_elements);
+  for (int i = 0; i < 1000; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  CU_ASSERT(linked_list_write_fd(list, ends[1]));
+  CU_ASSERT(write(ends[1], "garbage garbage garbage garbage garbage", 40) == 40);
+  close(ends[1]);
+  const list_options_t doubly = { .fun = compare_int_elements, .doubly_linked = true };
+  list_t *piped = linked_list_read_fd(ends[0], &doubly);
+  CU_ASSERT(linked_list_size(piped) == 1000);
+  list_iterator_t *iter = list_iterator(piped);
+  iterator_to_end(iter);
+  for (int i = 999; i >= 0; --i)
+    {
+      CU_ASSERT(iterator_previous(iter).i == i);
+    }
+  iterator_destroy(iter);
+  CU_ASSERT_PTR_NULL(linked_list_read_fd(ends[0], NULL));
+  close(ends[0]);
+  linked_list_destroy(piped);
+
+  // A stream that claims more elements than it holds yields no list, and takes
+  // no more memory than the elements that did arrive.
+  char stream[32 + 1000 * sizeof(elem_t)];
+  CU_ASSERT(pipe(ends) == 0);
+  CU_ASSERT(linked_list_write_fd(list, ends[1]));
+  CU_ASSERT(read(ends[0], stream, sizeof(stream)) == (ssize_t)sizeof(stream));
+  close(ends[0]);
+  close(ends[1]);
+  const uint64_t claims[] = { 1001, (uint64_t)1 << 40, (uint64_t)1 << 60, UINT64_MAX };
+  const list_options_t targets[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .private_pool = true, .destructor = free_counted },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+  };
+  released_elements = 0;
+  for (size_t c = 0; c < sizeof(claims) / sizeof(claims[0]); ++c)
+    {
+      memcpy(stream + 24, &claims[c], sizeof(claims[c]));
+      for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); ++t)
+        {
+          CU_ASSERT(pipe(ends) == 0);
+          CU_ASSERT(write(ends[1], stream, sizeof(stream)) == (ssize_t)sizeof(stream));
+          close(ends[1]);
+          CU_ASSERT_PTR_NULL(linked_list_read_fd(ends[0], &targets[t]));
+          CU_ASSERT_PTR_NULL(linked_list_read_fd(ends[0], NULL));
+          close(ends[0]);
+        }
+    }
+  CU_ASSERT(released_elements == 0);
+  linked_list_destroy(list);
+}
+
 void test_iterator_create_destroy()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -43,6 +503,26 @@ void test_iterator_create_destroy()
   linked_list_destroy(list);
 }
 
+void test_iterator_init()
+{
+  list_t *list = linked_list_create(dummy_func_ptr);
+  linked_list_append(list, int_elem(1));
+  linked_list_append(list, int_elem(2));
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  CU_ASSERT(LIST_ITERATOR_SIZE == sizeof(storage));
+  CU_ASSERT(iterator_next(iter).i == 1);
+  iterator_insert(iter, int_elem(3));
+  CU_ASSERT(iterator_next(iter).i == 3);
+  CU_ASSERT(iterator_remove(iter).i == 2);
+  CU_ASSERT_FALSE(iterator_has_next(iter));
+  iterator_reset(iter);
+  CU_ASSERT(iterator_current(iter).i == 1);
+  linked_list_append(list, int_elem(4));
+  CU_ASSERT(linked_list_calculate_size(list) == 3);
+  linked_list_destroy(list);
+}
+
 void test_insert_size()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -74,6 +554,150 @@ void test_clear()
   linked_list_destroy(list);
 }
 
+static bool is_null(const elem_t value, const void *extra)
+{
+  (void)extra;
+  return value.p == NULL;
+}
+
+void test_clear_destructor()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements, .destructor = free_counted },
+    { .fun = compare_int_elements, .destructor = free_counted, .doubly_linked = true, .skip_index = true },
+    { .fun = compare_int_elements, .destructor = free_counted, .private_pool = true },
+    { .fun = compare_int_elements, .destructor = free_counted, .private_pool = true, .doubly_linked = true },
+    { .fun = compare_int_elements, .destructor = free_counted, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .destructor = free_counted, .layout = LIST_LAYOUT_ARRAY },
+    { .fun = compare_int_elements, .destructor = free_counted, .layout = LIST_LAYOUT_COMPACT },
+  };
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      // Every element that the list discards is released exactly once, and no other.
+      list_t *list = linked_list_create_with(&options[o]);
+      released_elements = 0;
+      for (int round = 0; round < 3; ++round)
+        {
+          for (int i = 0; i < 100; ++i)
+            {
+              int *payload = malloc(sizeof(int));
+              *payload = i;
+              linked_list_append(list, (elem_t) { .p = payload });
+            }
+          elem_t removed = linked_list_remove(list, 10);
+          CU_ASSERT(*(int *)removed.p == 10);
+          free(removed.p);
+          CU_ASSERT(released_elements == 99 * round);
+          linked_list_clear(list);
+          CU_ASSERT(released_elements == 99 * (round + 1));
+          CU_ASSERT(linked_list_is_empty(list));
+          CU_ASSERT(linked_list_calculate_size(list) == 0);
+        }
+      for (int i = 0; i < 10; ++i)
+        {
+          linked_list_prepend(list, (elem_t) { .p = malloc(sizeof(int)) });
+        }
+      CU_ASSERT(linked_list_get(list, 9).p != NULL);
+      linked_list_destroy(list);
+      CU_ASSERT(released_elements == 99 * 3 + 10);
+    }
+
+  list_t *list = linked_list_create_with(&options[0]);
+  released_elements = 0;
+  for (int i = 0; i < 10; ++i)
+    {
+      linked_list_append(list, (elem_t) { .p = malloc(sizeof(int)) });
+    }
+  CU_ASSERT(linked_list_retain_if(list, is_null, NULL) == 10);
+  CU_ASSERT(released_elements == 10);
+  linked_list_destroy(list);
+  CU_ASSERT(released_elements == 10);
+}
+
+void test_create_adaptive()
+{
+  const list_options_t invalid[] = {
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ADAPTIVE, .adaptive_to_array = 10, .adaptive_to_linked = 20 },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ADAPTIVE, .adaptive_to_array = 101 },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ADAPTIVE, .private_pool = true },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ADAPTIVE, .skip_index = true },
+  };
+  for (size_t o = 0; o < sizeof(invalid) / sizeof(invalid[0]); ++o)
+    {
+      CU_ASSERT_PTR_NULL(linked_list_create_with(&invalid[o]));
+    }
+  list_adaptive_stats_t stats = { .decisions = 7 };
+  list_t *fixed = linked_list_create(compare_int_elements);
+  CU_ASSERT_FALSE(linked_list_adaptive_stats(fixed, &stats));
+  CU_ASSERT(stats.decisions == 7);
+  linked_list_destroy(fixed);
+
+  // Moves between layouts keep the elements, which are neither lost nor released.
+  const list_options_t options = { .fun = compare_int_elements, .layout = LIST_LAYOUT_ADAPTIVE,
+                                   .hash = hash_int_element, .destructor = free_counted };
+  list_t *list = linked_list_create_with(&options);
+  int expected[1000];
+  released_elements = 0;
+  for (int i = 0; i < 1000; ++i)
+    {
+      int *payload = malloc(sizeof(int));
+      *payload = expected[i] = i;
+      linked_list_append(list, (elem_t) { .p = payload });
+    }
+  CU_ASSERT(linked_list_adaptive_stats(list, &stats));
+  CU_ASSERT(stats.layout == LIST_LAYOUT_LINKED);
+  CU_ASSERT(stats.positional_ops == 0);
+  CU_ASSERT(stats.decisions > 0);
+  CU_ASSERT(stats.to_array == 0);
+  const size_t decisions = stats.decisions;
+
+  // Mostly positional accesses move the list into the array layout once.
+  for (int i = 0; i < 3000; ++i)
+    {
+      const int index = 1 + (i * 37) % 998;
+      CU_ASSERT(*(int *)linked_list_get(list, index).p == expected[index]);
+    }
+  CU_ASSERT(linked_list_adaptive_stats(list, &stats));
+  CU_ASSERT(stats.layout == LIST_LAYOUT_ARRAY);
+  CU_ASSERT(stats.to_array == 1);
+  CU_ASSERT(stats.to_linked == 0);
+  CU_ASSERT(stats.elements_moved == 1000);
+  CU_ASSERT(stats.decisions > decisions);
+
+  // Queue accesses at both ends move it back into links.
+  for (int i = 0; i < 3000; ++i)
+    {
+      elem_t front = linked_list_pop_front(list);
+      CU_ASSERT(*(int *)front.p == expected[i % 1000]);
+      linked_list_append(list, front);
+    }
+  CU_ASSERT(linked_list_adaptive_stats(list, &stats));
+  CU_ASSERT(stats.layout == LIST_LAYOUT_LINKED);
+  CU_ASSERT(stats.to_array == 1);
+  CU_ASSERT(stats.to_linked == 1);
+  // The move back may happen between a removal and an append.
+  CU_ASSERT(stats.elements_moved == 1999 || stats.elements_moved == 2000);
+  CU_ASSERT(released_elements == 0);
+  CU_ASSERT(linked_list_calculate_size(list) == 1000);
+  list_iterator_t *iter = list_iterator(list);
+  for (int i = 0; i < 1000; ++i)
+    {
+      CU_ASSERT(*(int *)iterator_next(iter).p == expected[i]);
+    }
+  CU_ASSERT_FALSE(iterator_has_next(iter));
+  iterator_destroy(iter);
+
+  // Lists made from an adaptive list are adaptive too.
+  list_t *rest = linked_list_split_at(list, 500);
+  CU_ASSERT(linked_list_adaptive_stats(rest, &stats));
+  CU_ASSERT(stats.decisions == 0);
+  CU_ASSERT(linked_list_size(rest) == 500);
+  linked_list_destroy(rest);
+  CU_ASSERT(released_elements == 500);
+  linked_list_destroy(list);
+  CU_ASSERT(released_elements == 1000);
+}
+
 void test_get()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -124,6 +748,62 @@ void test_append()
   linked_list_destroy(list);
 }
 
+void test_append_prepend_array()
+{
+  const elem_t values[] = { int_elem(1), int_elem(2), int_elem(3) };
+  const list_options_t options[] =
+    {
+      { .fun = compare_int_elements },
+      { .fun = compare_int_elements, .private_pool = true },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+    };
+  for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); ++i)
+    {
+      list_t *list = linked_list_create_with(&options[i]);
+      linked_list_prepend_array(list, values, 3);
+      linked_list_append_array(list, values, 0);
+      linked_list_append_array(list, values, 2);
+      linked_list_prepend_array(list, values + 2, 1);
+      CU_ASSERT(linked_list_size(list) == 6);
+      CU_ASSERT(linked_list_calculate_size(list) == 6);
+      const int expected[] = { 3, 1, 2, 3, 1, 2 };
+      for (int j = 0; j < 6; ++j)
+        {
+          CU_ASSERT(linked_list_get(list, j).i == expected[j]);
+        }
+      linked_list_append(list, int_elem(4));
+      CU_ASSERT(linked_list_get(list, 6).i == 4);
+      linked_list_destroy(list);
+    }
+}
+
+void test_extend()
+{
+  list_t *list = linked_list_create_pooled(compare_int_elements, NULL);
+  const list_options_t options = { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED };
+  list_t *other = linked_list_create_with(&options);
+  linked_list_extend(list, other);
+  CU_ASSERT(linked_list_is_empty(list));
+  for (int i = 0; i < 10; ++i)
+    {
+      linked_list_append(other, int_elem(i));
+    }
+  linked_list_extend(list, other);
+  linked_list_extend(list, list);
+  linked_list_extend(other, list);
+  CU_ASSERT(linked_list_size(list) == 20);
+  CU_ASSERT(linked_list_size(other) == 30);
+  for (int i = 0; i < 30; ++i)
+    {
+      CU_ASSERT(linked_list_get(other, i).i == i % 10);
+    }
+  CU_ASSERT(linked_list_calculate_size(list) == 20);
+  linked_list_destroy(list);
+  linked_list_destroy(other);
+}
+
 void test_remove()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -136,9 +816,134 @@ void test_remove()
   CU_ASSERT(second_result.i == 2);
   elem_t third_result = linked_list_remove(list, 2);
   CU_ASSERT(third_result.i == -1);
+  elem_t fourth_result = linked_list_remove(list, 1);
+  CU_ASSERT(fourth_result.i == 3);
+  linked_list_append(list, int_elem(4));
+  CU_ASSERT(linked_list_get(list, 1).i == 4);
   linked_list_destroy(list);
 }
 
+void test_skip_index()
+{
+  const list_options_t options = { .fun = compare_int_elements, .skip_index = true };
+  list_t *indexed = linked_list_create_with(&options);
+  list_t *plain = linked_list_create(compare_int_elements);
+  unsigned int state = 12345;
+  for (int i = 0; i < 4000; ++i)
+    {
+      state = state * 1103515245 + 12345;
+      const unsigned int choice = (state >> 16) % 8;
+      const int size = (int)linked_list_size(plain);
+      const int index = size > 0 ? (int)((state >> 4) % (unsigned int)size) : 0;
+      if (choice == 0)
+        {
+          linked_list_append(indexed, int_elem(i));
+          linked_list_append(plain, int_elem(i));
+        }
+      else if (choice == 1)
+        {
+          linked_list_prepend(indexed, int_elem(i));
+          linked_list_prepend(plain, int_elem(i));
+        }
+      else if (choice <= 4)
+        {
+          linked_list_insert(indexed, index, int_elem(i));
+          linked_list_insert(plain, index, int_elem(i));
+        }
+      else if (choice == 5)
+        {
+          CU_ASSERT(linked_list_remove(indexed, 0).i == linked_list_remove(plain, 0).i);
+        }
+      else
+        {
+          CU_ASSERT(linked_list_remove(indexed, index).i == linked_list_remove(plain, index).i);
+        }
+      if (i % 500 == 0)
+        {
+          const elem_t values[] = { int_elem(-1), int_elem(-2) };
+          linked_list_append_array(indexed, values, 2);
+          linked_list_append_array(plain, values, 2);
+          list_iterator_t *iter = list_iterator(indexed);
+          iterator_next(iter);
+          iterator_insert(iter, int_elem(-3));
+          iterator_next(iter);
+          iterator_remove(iter);
+          iterator_destroy(iter);
+          linked_list_insert(plain, 1, int_elem(-3));
+          linked_list_remove(plain, 2);
+        }
+      const int probe = (int)((state >> 8) % (linked_list_size(plain) + 1));
+      CU_ASSERT(linked_list_get(indexed, probe).i == linked_list_get(plain, probe).i);
+    }
+  CU_ASSERT(linked_list_size(indexed) == linked_list_size(plain));
+  for (int i = 0; i < (int)linked_list_size(plain); ++i)
+    {
+      CU_ASSERT(linked_list_get(indexed, i).i == linked_list_get(plain, i).i);
+    }
+  linked_list_clear(indexed);
+  linked_list_append(indexed, int_elem(7));
+  CU_ASSERT(linked_list_get(indexed, 0).i == 7);
+  linked_list_destroy(indexed);
+  linked_list_destroy(plain);
+}
+
+static bool is_multiple(const elem_t value, const void *extra)
+{
+  return value.i % *(const int *)extra == 0;
+}
+
+void test_remove_retain_if()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true, .hash = hash_int_element },
+    { .fun = compare_int_elements, .private_pool = true },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED, .hash = hash_int_element },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY, .hash = hash_int_element },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT, .hash = hash_int_element },
+  };
+  const int two = 2;
+  const int three = 3;
+  const int one = 1;
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      list_t *list = linked_list_create_with(&options[o]);
+      CU_ASSERT(linked_list_remove_if(list, is_multiple, &two) == 0);
+      for (int i = 0; i < 300; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+        }
+
+      // Keep the multiples of three, then remove the even ones among them.
+      CU_ASSERT(linked_list_retain_if(list, is_multiple, &three) == 200);
+      CU_ASSERT(linked_list_remove_if(list, is_multiple, &two) == 50);
+      CU_ASSERT(linked_list_size(list) == 50);
+      CU_ASSERT(linked_list_calculate_size(list) == 50);
+      for (int i = 0; i < 50; ++i)
+        {
+          CU_ASSERT(linked_list_get(list, i).i == 6 * i + 3);
+        }
+      CU_ASSERT(!linked_list_contains(list, int_elem(6)));
+      CU_ASSERT(linked_list_contains(list, int_elem(297)));
+      CU_ASSERT(linked_list_pop_back(list).i == 297);
+      linked_list_append(list, int_elem(1000));
+      CU_ASSERT(linked_list_get(list, 49).i == 1000);
+      CU_ASSERT(linked_list_remove_if(list, is_multiple, &two) == 1);
+      CU_ASSERT(linked_list_pop_front(list).i == 3);
+      CU_ASSERT(linked_list_retain_if(list, is_multiple, &one) == 0);
+
+      // Removing everything leaves an empty list that can be filled again.
+      CU_ASSERT(linked_list_remove_if(list, is_multiple, &one) == 48);
+      CU_ASSERT(linked_list_is_empty(list));
+      CU_ASSERT(!linked_list_contains(list, int_elem(9)));
+      linked_list_append(list, int_elem(5));
+      linked_list_prepend(list, int_elem(4));
+      CU_ASSERT(linked_list_get(list, 1).i == 5);
+      CU_ASSERT(linked_list_calculate_size(list) == 2);
+      linked_list_destroy(list);
+    }
+}
+
 void test_remove_invalid_index()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -169,6 +974,65 @@ void test_contains()
   linked_list_destroy(list);
 }
 
+void test_contains_hash_index()
+{
+  const list_options_t options[] =
+    {
+      { .fun = compare_int_elements, .hash = hash_int_element },
+      { .fun = compare_int_elements, .hash = hash_int_element_poorly },
+      { .fun = compare_int_elements, .hash = hash_int_element, .layout = LIST_LAYOUT_UNROLLED },
+      { .fun = compare_int_elements, .hash = hash_int_element, .layout = LIST_LAYOUT_ARRAY },
+      { .fun = compare_int_elements, .hash = hash_int_element, .layout = LIST_LAYOUT_COMPACT },
+    };
+  for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); ++i)
+    {
+      list_t *indexed = linked_list_create_with(&options[i]);
+      list_t *plain = linked_list_create(compare_int_elements);
+      const elem_t values[] = { int_elem(100), int_elem(101), int_elem(100) };
+      linked_list_append_array(indexed, values, 3);
+      linked_list_append_array(plain, values, 3);
+      for (int j = 0; j < 200; ++j)
+        {
+          linked_list_append(indexed, int_elem(j));
+          linked_list_append(plain, int_elem(j));
+          linked_list_prepend(indexed, int_elem(j * 3));
+          linked_list_prepend(plain, int_elem(j * 3));
+          linked_list_insert(indexed, j, int_elem(j * 5));
+          linked_list_insert(plain, j, int_elem(j * 5));
+        }
+      for (int j = 0; j < 300; ++j)
+        {
+          const int index = (j * 17) % (int)linked_list_size(plain);
+          linked_list_remove(indexed, index);
+          linked_list_remove(plain, index);
+        }
+      list_iterator_t *iter = list_iterator(indexed);
+      iterator_remove(iter);
+      iterator_insert(iter, int_elem(-7));
+      iterator_destroy(iter);
+      iter = list_iterator(plain);
+      iterator_remove(iter);
+      iterator_insert(iter, int_elem(-7));
+      iterator_destroy(iter);
+      for (int j = -10; j < 1100; ++j)
+        {
+          CU_ASSERT(linked_list_contains(indexed, int_elem(j)) == linked_list_contains(plain, int_elem(j)));
+        }
+
+      int value = 2000;
+      elem_t value_to_apply = int_elem(value);
+      linked_list_apply_to_all(indexed, set_value, &value_to_apply);
+      CU_ASSERT(linked_list_contains(indexed, int_elem(value)));
+      CU_ASSERT_FALSE(linked_list_contains(indexed, int_elem(-7)));
+      linked_list_clear(indexed);
+      CU_ASSERT_FALSE(linked_list_contains(indexed, int_elem(value)));
+      linked_list_append(indexed, int_elem(1));
+      CU_ASSERT(linked_list_contains(indexed, int_elem(1)));
+      linked_list_destroy(indexed);
+      linked_list_destroy(plain);
+    }
+}
+
 void test_is_empty()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -243,6 +1107,455 @@ void test_apply_to_all()
   linked_list_destroy(list);
 }
 
+static void add_and_count(elem_t *value, const void *extra)
+{
+  value->i += 1000;
+  atomic_fetch_add((atomic_int *)extra, 1);
+}
+
+/// Bound for int_less_counted, with the number of times it was tested.
+typedef struct counted_bound
+{
+  int bound;
+  atomic_int calls;
+} counted_bound_t;
+
+static bool int_less_counted(const elem_t element, const void *extra)
+{
+  counted_bound_t *counted = (counted_bound_t *)extra;
+  atomic_fetch_add(&counted->calls, 1);
+  return int_less(element, &counted->bound);
+}
+
+void test_parallel_apply_all_any()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+    { .fun = compare_int_elements, .hash = hash_int_element },
+  };
+  const int sizes[] = { 0, 1, 7, 1000 };
+  thread_pool_t *pools[] = { NULL, thread_pool_create(3) };
+  CU_ASSERT_PTR_NOT_NULL(pools[1]);
+  CU_ASSERT(thread_pool_threads(pools[1]) == 4);
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      for (size_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n)
+        {
+          for (size_t p = 0; p < 2; ++p)
+            {
+              list_t *list = linked_list_create_with(&options[o]);
+              for (int i = 0; i < sizes[n]; ++i)
+                {
+                  linked_list_append(list, int_elem(i));
+                }
+              atomic_int applied = 0;
+              linked_list_parallel_apply_to_all(list, pools[p], add_and_count, &applied);
+              CU_ASSERT(atomic_load(&applied) == sizes[n]);
+              for (int i = 0; i < sizes[n]; ++i)
+                {
+                  CU_ASSERT(linked_list_get(list, i).i == i + 1000);
+                }
+              CU_ASSERT(sizes[n] == 0 || linked_list_contains(list, int_elem(sizes[n] + 999)));
+              CU_ASSERT_FALSE(linked_list_contains(list, int_elem(0)));
+
+              counted_bound_t bound = { .bound = sizes[n] + 1000 };
+              CU_ASSERT(linked_list_parallel_all(list, pools[p], int_less_counted, &bound));
+              CU_ASSERT(atomic_load(&bound.calls) == sizes[n]);
+              CU_ASSERT_FALSE(linked_list_parallel_any(list, pools[p], int_less_counted, &(counted_bound_t) { .bound = 1000 }));
+              bound.bound = sizes[n] + 999;
+              CU_ASSERT(linked_list_parallel_all(list, pools[p], int_less_counted, &bound) == (sizes[n] == 0));
+              CU_ASSERT(linked_list_parallel_any(list, pools[p], int_less_counted, &(counted_bound_t) { .bound = 1001 }) == (sizes[n] > 0));
+              linked_list_destroy(list);
+            }
+        }
+    }
+
+  // Once the answer is known, the other threads stop testing elements.
+  list_t *list = linked_list_create(compare_int_elements);
+  for (int i = 0; i < 100000; ++i)
+    {
+      linked_list_append(list, int_elem(i));
+    }
+  counted_bound_t bound = { .bound = 100000 };
+  CU_ASSERT(linked_list_parallel_any(list, pools[1], int_less_counted, &bound));
+  CU_ASSERT(atomic_load(&bound.calls) < 1000);
+  bound.bound = 0;
+  atomic_store(&bound.calls, 0);
+  CU_ASSERT_FALSE(linked_list_parallel_all(list, pools[1], int_less_counted, &bound));
+  CU_ASSERT(atomic_load(&bound.calls) < 1000);
+  linked_list_destroy(list);
+  thread_pool_destroy(pools[1]);
+}
+
+void test_all_any_counters()
+{
+  const list_layout_t layouts[] = { LIST_LAYOUT_LINKED, LIST_LAYOUT_UNROLLED, LIST_LAYOUT_ARRAY, LIST_LAYOUT_COMPACT };
+  for (size_t l = 0; l < 2; ++l)
+    {
+      list_t *list = linked_list_create_with(&(list_options_t) { .fun = compare_int_elements, .layout = layouts[l] });
+      for (int i = 0; i < 1000; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+        }
+      list_counters_t counters = { 0 };
+      linked_list_set_counters(list, &counters);
+
+      // A property that fails on the third element stops the walk there.
+      int bound = 2;
+      CU_ASSERT_FALSE(linked_list_all(list, int_less, &bound));
+      CU_ASSERT(counters.predicate_calls == 3);
+      CU_ASSERT(counters.nodes_visited == (l == 0 ? 3 : 1));
+
+      counters = (list_counters_t) { 0 };
+      bound = 1;
+      CU_ASSERT(linked_list_any(list, int_less, &bound));
+      CU_ASSERT(counters.predicate_calls == 1);
+      CU_ASSERT(counters.nodes_visited == 1);
+
+      counters = (list_counters_t) { 0 };
+      bound = 1000;
+      CU_ASSERT(linked_list_all(list, int_less, &bound));
+      bound = 0;
+      CU_ASSERT_FALSE(linked_list_any(list, int_less, &bound));
+      CU_ASSERT(counters.predicate_calls == 2000);
+      CU_ASSERT(l == 0 ? counters.nodes_visited == 2000 : counters.nodes_visited < 400);
+
+      // The parallel variants count as well, and a NULL pool walks the list in one run.
+      counters = (list_counters_t) { 0 };
+      bound = 2;
+      CU_ASSERT_FALSE(linked_list_parallel_all(list, NULL, int_less, &bound));
+      CU_ASSERT(counters.predicate_calls == 3);
+      CU_ASSERT(counters.nodes_visited == (l == 0 ? 3 : 1));
+
+      // Detached counters are left alone.
+      linked_list_set_counters(list, NULL);
+      CU_ASSERT(linked_list_any(list, int_less, &bound));
+      CU_ASSERT(counters.predicate_calls == 3);
+      linked_list_destroy(list);
+    }
+}
+
+static void count_calls(elem_t *value, const void *extra)
+{
+  (void)value;
+  *(int *)extra += 1;
+}
+
+void test_apply_to_all_elements_only()
+{
+  list_t *list = linked_list_create(compare_int_elements);
+  int calls = 0;
+  linked_list_apply_to_all(list, count_calls, &calls);
+  CU_ASSERT(calls == 0);
+  linked_list_append(list, int_elem(1));
+  linked_list_append(list, int_elem(2));
+  linked_list_apply_to_all(list, count_calls, &calls);
+  CU_ASSERT(calls == 2);
+  linked_list_destroy(list);
+}
+
+/// Order elements by their thousands, so that the remainder shows whether equal elements kept their order.
+static int compare_thousands(const elem_t a, const elem_t b)
+{
+  return (a.i / 1000 > b.i / 1000) - (a.i / 1000 < b.i / 1000);
+}
+
+static bool is_sorted_stably(list_t *list, const size_t expected_size)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  size_t count = 0;
+  int previous = -1;
+  bool sorted = true;
+  while (iterator_has_next(iter))
+    {
+      const int value = iterator_next(iter).i;
+      sorted = sorted && (previous < 0 || compare_thousands(int_elem(previous), int_elem(value)) < 0
+                          || (compare_thousands(int_elem(previous), int_elem(value)) == 0 && previous < value));
+      previous = value;
+      ++count;
+    }
+  return sorted && count == expected_size && linked_list_size(list) == expected_size;
+}
+
+void test_sort()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true, .hash = hash_int_element },
+    { .fun = compare_int_elements, .private_pool = true },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+  };
+  const size_t sizes[] = { 0, 1, 2, 3, 17, 1000 };
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      for (size_t n = 0; n < sizeof(sizes) / sizeof(sizes[0]); ++n)
+        {
+          // Keys between 0 and 9 in the thousands, numbered in the order they were added.
+          list_t *list = linked_list_create_with(&options[o]);
+          unsigned int state = 7;
+          for (size_t i = 0; i < sizes[n]; ++i)
+            {
+              state = state * 1103515245 + 12345;
+              linked_list_append(list, int_elem((int)((state >> 16) % 10) * 1000 + (int)i));
+            }
+          linked_list_sort(list, compare_thousands);
+          CU_ASSERT(is_sorted_stably(list, sizes[n]));
+
+          // The list stays consistent: its end, positions, back links and index.
+          if (sizes[n] > 0)
+            {
+              const elem_t last = linked_list_get(list, (int)sizes[n] - 1);
+              const elem_t first = linked_list_get(list, 0);
+              CU_ASSERT(linked_list_contains(list, last));
+              CU_ASSERT(linked_list_pop_back(list).i == last.i);
+              linked_list_append(list, int_elem(99999));
+              CU_ASSERT(linked_list_get(list, (int)sizes[n] - 1).i == 99999);
+              CU_ASSERT(sizes[n] == 1 || linked_list_get(list, 0).i == first.i);
+              linked_list_remove(list, (int)sizes[n] - 1);
+              linked_list_prepend(list, first);
+              CU_ASSERT(linked_list_remove(list, 0).i == first.i);
+            }
+          linked_list_sort(list, compare_thousands);
+          CU_ASSERT(is_sorted_stably(list, sizes[n] > 0 ? sizes[n] - 1 : 0));
+          linked_list_destroy(list);
+        }
+    }
+}
+
+void test_insert_sorted()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true, .hash = hash_int_element },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+  };
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      list_t *list = linked_list_create_with(&options[o]);
+      unsigned int state = 11;
+      for (int i = 0; i < 500; ++i)
+        {
+          state = state * 1103515245 + 12345;
+          linked_list_insert_sorted(list, compare_thousands, int_elem((int)((state >> 16) % 20) * 1000 + i));
+        }
+      CU_ASSERT(is_sorted_stably(list, 500));
+
+      // Elements that belong at either end, and positional access after insertions.
+      linked_list_insert_sorted(list, compare_thousands, int_elem(99999));
+      linked_list_insert_sorted(list, compare_thousands, int_elem(-1000));
+      CU_ASSERT(linked_list_get(list, 501).i == 99999);
+      CU_ASSERT(linked_list_get(list, 0).i == -1000);
+      CU_ASSERT(linked_list_contains(list, int_elem(99999)));
+      CU_ASSERT(linked_list_pop_back(list).i == 99999);
+      CU_ASSERT(linked_list_pop_front(list).i == -1000);
+      for (int i = 0; i < 500; ++i)
+        {
+          const elem_t value = linked_list_get(list, i);
+          CU_ASSERT(i == 0 || compare_thousands(linked_list_get(list, i - 1), value) <= 0);
+        }
+      linked_list_destroy(list);
+    }
+}
+
+/// Check that a list holds exactly the integers [first, first + count) in order, and can find them.
+static bool holds_range(list_t *list, const int first, const int count)
+{
+  list_iterator_storage_t storage;
+  list_iterator_t *iter = list_iterator_init(&storage, list);
+  bool valid = linked_list_size(list) == (size_t)count && linked_list_calculate_size(list) == (size_t)count;
+  for (int i = 0; i < count && valid; ++i)
+    {
+      valid = iterator_has_next(iter) && iterator_next(iter).i == first + i
+        && linked_list_contains(list, int_elem(first + i)) && linked_list_get(list, i).i == first + i;
+    }
+  valid = valid && !iterator_has_next(iter) && !linked_list_contains(list, int_elem(first + count));
+  if (valid && count > 0)
+    {
+      // The end of the list is intact: a new element goes after the last one.
+      linked_list_append(list, int_elem(-7));
+      valid = linked_list_get(list, count - 1).i == first + count - 1 && linked_list_pop_back(list).i == -7;
+    }
+  return valid;
+}
+
+void test_concat_split_splice()
+{
+  pool_t *pool = linked_list_pool_create(0);
+  const list_options_t options[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true, .hash = hash_int_element },
+    { .fun = compare_int_elements, .pool = pool },
+    { .fun = compare_int_elements, .private_pool = true, .hash = hash_int_element },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+    { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+  };
+  const size_t count = sizeof(options) / sizeof(options[0]);
+  for (size_t o = 0; o < count; ++o)
+    {
+      for (size_t p = 0; p < count; ++p)
+        {
+          // Concatenation empties the other list, which stays usable.
+          list_t *list = linked_list_create_with(&options[o]);
+          list_t *other = linked_list_create_with(&options[p]);
+          for (int i = 0; i < 40; ++i)
+            {
+              linked_list_append(i < 25 ? list : other, int_elem(i));
+            }
+          linked_list_concat(list, other);
+          CU_ASSERT(holds_range(list, 0, 40));
+          CU_ASSERT(holds_range(other, 0, 0));
+          linked_list_concat(other, list);
+          CU_ASSERT(holds_range(other, 0, 40));
+          CU_ASSERT(holds_range(list, 0, 0));
+          linked_list_concat(list, other);
+          linked_list_concat(list, list);
+          CU_ASSERT(holds_range(list, 0, 40));
+
+          // Splicing moves a range to the position of another iterator.
+          list_iterator_storage_t storage;
+          list_iterator_t *iter = list_iterator_init(&storage, other);
+          list_iterator_storage_t source_storage;
+          list_iterator_t *source = list_iterator_init(&source_storage, list);
+          for (int i = 0; i < 10; ++i)
+            {
+              iterator_next(source);
+            }
+          iterator_splice(iter, source, 20);
+          CU_ASSERT(holds_range(other, 10, 20));
+          CU_ASSERT(linked_list_size(list) == 20);
+          CU_ASSERT(linked_list_get(list, 9).i == 9);
+          CU_ASSERT(linked_list_get(list, 10).i == 30);
+          CU_ASSERT(!linked_list_contains(list, int_elem(10)));
+          list_iterator_init(&storage, other);
+          list_iterator_init(&source_storage, list);
+          iterator_splice(iter, source, 10);
+          CU_ASSERT(iterator_current(iter).i == 10);
+          iterator_to_end(iter);
+          iterator_splice(iter, source, 100);
+          CU_ASSERT(holds_range(other, 0, 40));
+          CU_ASSERT(holds_range(list, 0, 0));
+
+          // Splitting moves the elements from a position onwards to a new list.
+          list_t *tail = linked_list_split_at(other, 15);
+          CU_ASSERT(holds_range(other, 0, 15));
+          CU_ASSERT(holds_range(tail, 15, 25));
+          list_t *empty = linked_list_split_at(tail, 25);
+          CU_ASSERT(holds_range(empty, 0, 0));
+          list_t *whole = linked_list_split_at(tail, -25);
+          CU_ASSERT(holds_range(tail, 0, 0));
+          CU_ASSERT(holds_range(whole, 15, 25));
+          CU_ASSERT(linked_list_split_at(whole, 26) == NULL);
+          linked_list_concat(other, whole);
+          CU_ASSERT(holds_range(other, 0, 40));
+          linked_list_destroy(whole);
+          linked_list_destroy(empty);
+          linked_list_destroy(tail);
+          linked_list_destroy(list);
+          linked_list_destroy(other);
+        }
+    }
+  pool_destroy(pool);
+}
+
+void test_concat_destructor()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements, .destructor = free_counted },
+    { .fun = compare_int_elements, .destructor = free_counted, .private_pool = true },
+    { .fun = compare_int_elements, .destructor = free_counted, .layout = LIST_LAYOUT_UNROLLED },
+    { .fun = compare_int_elements, .destructor = free_counted, .layout = LIST_LAYOUT_COMPACT },
+  };
+  const size_t count = sizeof(options) / sizeof(options[0]);
+  for (size_t o = 0; o < count; ++o)
+    {
+      for (size_t p = 0; p < count; ++p)
+        {
+          // Elements moved by concatenation or splitting are released once, by the list that ends up owning them.
+          list_t *list = linked_list_create_with(&options[o]);
+          list_t *other = linked_list_create_with(&options[p]);
+          released_elements = 0;
+          for (int i = 0; i < 40; ++i)
+            {
+              int *payload = malloc(sizeof(int));
+              *payload = i;
+              linked_list_append(i < 25 ? list : other, (elem_t) { .p = payload });
+            }
+          linked_list_concat(list, other);
+          CU_ASSERT(released_elements == 0);
+          CU_ASSERT(linked_list_is_empty(other));
+          CU_ASSERT(linked_list_size(list) == 40);
+          CU_ASSERT(*(int *)linked_list_get(list, 30).p == 30);
+          list_t *tail = linked_list_split_at(list, 10);
+          CU_ASSERT(released_elements == 0);
+          CU_ASSERT(*(int *)linked_list_get(tail, 0).p == 10);
+          linked_list_concat(other, tail);
+          CU_ASSERT(released_elements == 0);
+          CU_ASSERT(*(int *)linked_list_get(other, 29).p == 39);
+          linked_list_destroy(tail);
+          linked_list_destroy(list);
+          CU_ASSERT(released_elements == 10);
+          linked_list_destroy(other);
+          CU_ASSERT(released_elements == 40);
+        }
+    }
+}
+
+void test_splice_within_list()
+{
+  const list_options_t options[] = {
+    { .fun = compare_int_elements },
+    { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true, .hash = hash_int_element },
+  };
+  for (size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o)
+    {
+      // Move [30, 40) from the front to the end, back to the front and to the end again.
+      list_t *list = linked_list_create_with(&options[o]);
+      for (int i = 0; i < 40; ++i)
+        {
+          linked_list_append(list, int_elem((i + 30) % 40));
+        }
+      list_iterator_storage_t storage;
+      list_iterator_t *iter = list_iterator_init(&storage, list);
+      list_iterator_storage_t source_storage;
+      list_iterator_t *source = list_iterator_init(&source_storage, list);
+      iterator_to_end(iter);
+      iterator_splice(iter, source, 10);
+      CU_ASSERT(holds_range(list, 0, 40));
+      for (int i = 0; i < 30; ++i)
+        {
+          iterator_next(source);
+        }
+      iterator_reset(iter);
+      iterator_splice(iter, source, 10);
+      CU_ASSERT(linked_list_get(list, 0).i == 30 && linked_list_get(list, 10).i == 0);
+      CU_ASSERT(linked_list_get(list, 39).i == 29 && linked_list_pop_back(list).i == 29);
+      linked_list_append(list, int_elem(29));
+      iterator_reset(source);
+      iterator_to_end(iter);
+      iterator_splice(iter, source, 10);
+      CU_ASSERT(holds_range(list, 0, 40));
+
+      // A range may not be moved after one of its own elements.
+      iterator_reset(iter);
+      iterator_next(iter);
+      iterator_reset(source);
+      iterator_splice(iter, source, 5);
+      iterator_splice(source, source, 5);
+      CU_ASSERT(holds_range(list, 0, 40));
+      linked_list_destroy(list);
+    }
+}
+
 void test_iterator_current()
 {
   list_t *list = linked_list_create(dummy_func_ptr);
@@ -253,6 +1566,248 @@ void test_iterator_current()
   linked_list_destroy(list);
 }
 
+void test_pop_front_back()
+{
+  const list_options_t variants[] =
+    {
+      { .fun = compare_int_elements },
+      { .fun = compare_int_elements, .doubly_linked = true },
+      { .fun = compare_int_elements, .doubly_linked = true, .private_pool = true, .skip_index = true },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+    };
+  for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v)
+    {
+      list_t *list = linked_list_create_with(&variants[v]);
+      CU_ASSERT(linked_list_pop_back(list).i == -1);
+      CU_ASSERT(linked_list_pop_front(list).i == -1);
+      for (int i = 0; i < 10; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+        }
+      CU_ASSERT(linked_list_pop_back(list).i == 9);
+      CU_ASSERT(linked_list_pop_front(list).i == 0);
+      linked_list_insert(list, 4, int_elem(42));
+      CU_ASSERT(linked_list_remove(list, 2).i == 3);
+      CU_ASSERT(linked_list_get(list, 6).i == 7);
+      CU_ASSERT(linked_list_get(list, 7).i == 8);
+      CU_ASSERT(linked_list_pop_back(list).i == 8);
+      linked_list_append(list, int_elem(9));
+      const int expected[] = { 9, 7, 6, 5, 42, 4, 2, 1 };
+      for (size_t i = 0; i < 8; ++i)
+        {
+          CU_ASSERT(linked_list_pop_back(list).i == expected[i]);
+        }
+      CU_ASSERT(linked_list_is_empty(list));
+      CU_ASSERT(linked_list_pop_back(list).i == -1);
+      linked_list_prepend(list, int_elem(1));
+      CU_ASSERT(linked_list_pop_back(list).i == 1);
+      linked_list_destroy(list);
+    }
+
+  const list_options_t unrolled = { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED, .doubly_linked = true };
+  CU_ASSERT_PTR_NULL(linked_list_create_with(&unrolled));
+  pool_t *pool = linked_list_pool_create(0);
+  const list_options_t pooled = { .fun = compare_int_elements, .pool = pool, .doubly_linked = true };
+  CU_ASSERT_PTR_NULL(linked_list_create_with(&pooled));
+  pool_destroy(pool);
+}
+
+void test_reverse_iteration()
+{
+  const list_options_t variants[] =
+    {
+      { .fun = compare_int_elements },
+      { .fun = compare_int_elements, .doubly_linked = true },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_UNROLLED },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_ARRAY },
+      { .fun = compare_int_elements, .layout = LIST_LAYOUT_COMPACT },
+    };
+  for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v)
+    {
+      list_t *list = linked_list_create_with(&variants[v]);
+      list_iterator_storage_t storage;
+      list_iterator_t *iter = list_iterator_init(&storage, list);
+      iterator_to_end(iter);
+      CU_ASSERT_FALSE(iterator_has_previous(iter));
+      CU_ASSERT(iterator_previous(iter).i == -1);
+      for (int i = 0; i < 40; ++i)
+        {
+          linked_list_append(list, int_elem(i));
+        }
+      iterator_to_end(iter);
+      CU_ASSERT_FALSE(iterator_has_next(iter));
+      for (int i = 39; i >= 0; --i)
+        {
+          CU_ASSERT(iterator_has_previous(iter));
+          CU_ASSERT(iterator_previous(iter).i == i);
+          CU_ASSERT(iterator_current(iter).i == i);
+        }
+      CU_ASSERT_FALSE(iterator_has_previous(iter));
+      CU_ASSERT(iterator_next(iter).i == 0);
+      CU_ASSERT(iterator_next(iter).i == 1);
+      CU_ASSERT(iterator_previous(iter).i == 1);
+
+      // Remove the odd elements while walking backwards.
+      iterator_to_end(iter);
+      while (iterator_has_previous(iter))
+        {
+          const elem_t value = iterator_previous(iter);
+          if (value.i % 2 == 1)
+            {
+              CU_ASSERT(iterator_remove(iter).i == value.i);
+            }
+        }
+      iterator_to_end(iter);
+      for (int i = 19; i >= 0; --i)
+        {
+          CU_ASSERT(iterator_previous(iter).i == 2 * i);
+        }
+      CU_ASSERT_FALSE(iterator_has_previous(iter));
+      linked_list_destroy(list);
+    }
+}
+
+void test_cursor_access()
+{
+  const list_options_t variants[] =
+    {
+      { .fun = compare_int_elements },
+      { .fun = compare_int_elements, .doubly_linked = true },
+      { .fun = compare_int_elements, .skip_index = true },
+      { .fun = compare_int_elements, .doubly_linked = true, .skip_index = true },
+    };
+  for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v)
+    {
+      list_t *list = linked_list_create_with(&variants[v]);
+      int model[3000];
+      int size = 0;
+      int position = 0;
+      unsigned int state = 4321;
+      for (int i = 0; i < 3000; ++i)
+        {
+          state = state * 1103515245 + 12345;
+          const unsigned int choice = (state >> 16) % 10;
+          // Mostly access positions close to the previous one.
+          position += (int)((state >> 4) % 5) - 1;
+          if (position < 0 || position >= size)
+            {
+              position = size > 0 ? (int)((state >> 8) % (unsigned int)size) : 0;
+            }
+          if (choice <= 3 || size == 0)
+            {
+              linked_list_insert(list, position, int_elem(i));
+              memmove(&model[position + 1], &model[position], (size_t)(size - position) * sizeof(int));
+              model[position] = i;
+              ++size;
+            }
+          else if (choice == 4)
+            {
+              CU_ASSERT(linked_list_remove(list, position).i == model[position]);
+              memmove(&model[position], &model[position + 1], (size_t)(size - position - 1) * sizeof(int));
+              --size;
+            }
+          else if (choice == 5)
+            {
+              linked_list_prepend(list, int_elem(i));
+              memmove(&model[1], &model[0], (size_t)size * sizeof(int));
+              model[0] = i;
+              ++size;
+            }
+          else if (choice == 6)
+            {
+              CU_ASSERT(linked_list_pop_back(list).i == model[--size]);
+            }
+          else if (choice == 7 && size >= 2)
+            {
+              list_iterator_storage_t storage;
+              list_iterator_t *iter = list_iterator_init(&storage, list);
+              iterator_next(iter);
+              CU_ASSERT(iterator_remove(iter).i == model[1]);
+              iterator_insert(iter, int_elem(-i));
+              model[1] = -i;
+            }
+          else
+            {
+              CU_ASSERT(linked_list_get(list, position).i == model[position]);
+            }
+          CU_ASSERT(linked_list_size(list) == (size_t)size);
+        }
+      for (int i = 0; i < size; ++i)
+        {
+          CU_ASSERT(linked_list_get(list, i).i == model[i]);
+        }
+      for (int i = size - 1; i >= 0; --i)
+        {
+          CU_ASSERT(linked_list_get(list, i).i == model[i]);
+        }
+      linked_list_destroy(list);
+    }
+}
+
+void test_contains_typed()
+{
+  const list_layout_t layouts[] = { LIST_LAYOUT_LINKED, LIST_LAYOUT_UNROLLED, LIST_LAYOUT_ARRAY, LIST_LAYOUT_COMPACT };
+  int targets[3];
+  for (size_t l = 0; l < 2; ++l)
+    {
+      const list_options_t int_options = { .eq_kind = LIST_EQ_INT, .layout = layouts[l] };
+      list_t *ints = linked_list_create_with(&int_options);
+      for (int i = 0; i < 100; ++i)
+        {
+          linked_list_append(ints, int_elem(3 * i - 50));
+        }
+      CU_ASSERT(linked_list_contains(ints, int_elem(-50)));
+      CU_ASSERT(linked_list_contains(ints, int_elem(247)));
+      CU_ASSERT_FALSE(linked_list_contains(ints, int_elem(248)));
+      CU_ASSERT(linked_list_remove(ints, 99).i == 247);
+      CU_ASSERT_FALSE(linked_list_contains(ints, int_elem(247)));
+      linked_list_destroy(ints);
+
+      const list_options_t unsigned_options = { .eq_kind = LIST_EQ_UNSIGNED, .layout = layouts[l] };
+      list_t *unsigneds = linked_list_create_with(&unsigned_options);
+      linked_list_append(unsigneds, unsigned_int_elem(4000000000u));
+      CU_ASSERT(linked_list_contains(unsigneds, unsigned_int_elem(4000000000u)));
+      CU_ASSERT_FALSE(linked_list_contains(unsigneds, unsigned_int_elem(4)));
+      linked_list_destroy(unsigneds);
+
+      const list_options_t bool_options = { .eq_kind = LIST_EQ_BOOL, .layout = layouts[l] };
+      list_t *bools = linked_list_create_with(&bool_options);
+      CU_ASSERT_FALSE(linked_list_contains(bools, bool_elem(true)));
+      linked_list_append(bools, bool_elem(false));
+      CU_ASSERT(linked_list_contains(bools, bool_elem(false)));
+      CU_ASSERT_FALSE(linked_list_contains(bools, bool_elem(true)));
+      linked_list_destroy(bools);
+
+      const list_options_t float_options = { .eq_kind = LIST_EQ_FLOAT, .layout = layouts[l] };
+      list_t *floats = linked_list_create_with(&float_options);
+      linked_list_append(floats, float_elem(1.5f));
+      linked_list_append(floats, float_elem(0.0f));
+      linked_list_append(floats, float_elem(0.0f / 0.0f));
+      CU_ASSERT(linked_list_contains(floats, float_elem(1.5f)));
+      CU_ASSERT(linked_list_contains(floats, float_elem(-0.0f)));
+      CU_ASSERT_FALSE(linked_list_contains(floats, float_elem(0.0f / 0.0f)));
+      linked_list_destroy(floats);
+
+      const list_options_t pointer_options = { .eq_kind = LIST_EQ_POINTER, .layout = layouts[l] };
+      list_t *pointers = linked_list_create_with(&pointer_options);
+      linked_list_append(pointers, ptr_elem(&targets[0]));
+      linked_list_append(pointers, ptr_elem(&targets[1]));
+      CU_ASSERT(linked_list_contains(pointers, ptr_elem(&targets[1])));
+      CU_ASSERT_FALSE(linked_list_contains(pointers, ptr_elem(&targets[2])));
+      linked_list_destroy(pointers);
+    }
+
+  // The built-in comparison replaces fun, including in the hash index.
+  const list_options_t hashed = { .fun = compare_int_elements_never, .eq_kind = LIST_EQ_INT, .hash = hash_int_element };
+  list_t *list = linked_list_create_with(&hashed);
+  linked_list_append(list, int_elem(7));
+  CU_ASSERT(linked_list_contains(list, int_elem(7)));
+  CU_ASSERT_FALSE(linked_list_contains(list, int_elem(8)));
+  linked_list_destroy(list);
+}
+
 int main()
 {
   if (CUE_SUCCESS != CU_initialize_registry())
@@ -264,10 +1819,18 @@ int main()
   CU_pSuite retrieval = CU_add_suite("Retrieval", NULL, NULL);
   CU_pSuite removal = CU_add_suite("Removal", NULL, NULL);
   CU_pSuite function_application = CU_add_suite("Function Application", NULL, NULL);
+  CU_pSuite ordering = CU_add_suite("Ordering", NULL, NULL);
   
   CU_add_test(creation, "List Creation", test_create_destroy);
+  CU_add_test(creation, "Pooled List Creation", test_create_pooled);
+  CU_add_test(creation, "Shared Pool List Creation", test_create_shared_pool);
+  CU_add_test(creation, "Unrolled, Array And Compact List Creation", test_create_unrolled);
+  CU_add_test(creation, "List Creation In An Arena", test_create_in_arena);
+  CU_add_test(creation, "Adaptive List Creation", test_create_adaptive);
   CU_add_test(creation, "Iterator Creation", test_iterator_create_destroy);
+  CU_add_test(creation, "Iterator Initialisation", test_iterator_init);
   CU_add_test(creation, "Clear", test_clear);
+  CU_add_test(creation, "Clear With A Destructor", test_clear_destructor);
 
   CU_add_test(size, "Size", test_insert_size);
   CU_add_test(size, "Calculate Size", test_calculate_size);
@@ -276,17 +1839,39 @@ int main()
   CU_add_test(insertion, "Insert At Invalid Index", test_insert_invalid_index);
   CU_add_test(insertion, "Prepend", test_prepend);
   CU_add_test(insertion, "Append", test_append);
+  CU_add_test(insertion, "Append And Prepend Arrays", test_append_prepend_array);
+  CU_add_test(insertion, "Extend", test_extend);
+  CU_add_test(insertion, "Concatenate, Split And Splice", test_concat_split_splice);
+  CU_add_test(insertion, "Concatenate With A Destructor", test_concat_destructor);
+  CU_add_test(insertion, "Splice Within A List", test_splice_within_list);
 
   CU_add_test(retrieval, "Get", test_get);
+  CU_add_test(retrieval, "Sequential Positional Access", test_cursor_access);
   CU_add_test(retrieval, "Iterator Current", test_iterator_current);
+  CU_add_test(retrieval, "Unrolled, Array And Compact Iterators", test_unrolled_iterator);
+  CU_add_test(retrieval, "Compact Iterators Survive Growth", test_compact_growth);
+  CU_add_test(retrieval, "Save And Open Mapped", test_save_open_mmap);
+  CU_add_test(retrieval, "Write And Read File Descriptors", test_write_read_fd);
   CU_add_test(retrieval, "Contains", test_contains);
+  CU_add_test(retrieval, "Contains With Hash Index", test_contains_hash_index);
+  CU_add_test(retrieval, "Contains With Built-in Comparison", test_contains_typed);
 
   CU_add_test(removal, "Remove", test_remove);
   CU_add_test(removal, "Remove At Invalid Index", test_remove_invalid_index);
+  CU_add_test(removal, "Remove If And Retain If", test_remove_retain_if);
+  CU_add_test(removal, "Positional Access With Skip Index", test_skip_index);
+  CU_add_test(removal, "Pop Front And Back", test_pop_front_back);
+  CU_add_test(removal, "Reverse Iteration", test_reverse_iteration);
 
   CU_add_test(function_application, "All", test_all);
   CU_add_test(function_application, "Any", test_any);
   CU_add_test(function_application, "Apply To All", test_apply_to_all);
+  CU_add_test(function_application, "Parallel Apply, All And Any", test_parallel_apply_all_any);
+  CU_add_test(function_application, "All And Any Counters", test_all_any_counters);
+  CU_add_test(function_application, "Apply To All Skips The Sentinel", test_apply_to_all_elements_only);
+
+  CU_add_test(ordering, "Sort", test_sort);
+  CU_add_test(ordering, "Insert Sorted", test_insert_sorted);
 
   CU_basic_set_mode(CU_BRM_VERBOSE);
   CU_basic_run_tests();
@@ -0,0 +1,192 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <CUnit/Basic.h>
+#include "lockfree_queue.h"
+
+/// Number of threads of every kind in the stress tests.
+#define STRESS_THREADS 4
+/// Number of elements added by every producer in the stress tests.
+#define STRESS_ELEMENTS 20000
+
+void test_create_destroy()
+{
+  lockfree_queue_t *queue = lockfree_queue_create();
+  CU_ASSERT_PTR_NOT_NULL(queue);
+  CU_ASSERT(lockfree_queue_is_empty(queue));
+  CU_ASSERT(lockfree_queue_size(queue) == 0);
+  lockfree_queue_destroy(queue);
+
+  // Destroying a queue that still holds elements frees them as well.
+  queue = lockfree_queue_create();
+  for (int i = 0; i < 100; ++i)
+    {
+      lockfree_queue_append(queue, int_elem(i));
+    }
+  lockfree_queue_destroy(queue);
+}
+
+void test_sequential_fifo()
+{
+  lockfree_queue_t *queue = lockfree_queue_create();
+  elem_t value = int_elem(-1);
+  CU_ASSERT_FALSE(lockfree_queue_pop_front(queue, &value));
+  CU_ASSERT(value.i == -1);
+  for (int i = 0; i < 1000; ++i)
+    {
+      CU_ASSERT(lockfree_queue_append(queue, int_elem(i)));
+    }
+  CU_ASSERT(lockfree_queue_size(queue) == 1000);
+  CU_ASSERT_FALSE(lockfree_queue_is_empty(queue));
+  for (int i = 0; i < 500; ++i)
+    {
+      CU_ASSERT(lockfree_queue_pop_front(queue, &value) && value.i == i);
+    }
+
+  // Interleaving appends and pops keeps the order.
+  for (int i = 1000; i < 1500; ++i)
+    {
+      lockfree_queue_append(queue, int_elem(i));
+      CU_ASSERT(lockfree_queue_pop_front(queue, &value) && value.i == i - 500);
+    }
+  CU_ASSERT(lockfree_queue_size(queue) == 500);
+  for (int i = 1000; i < 1500; ++i)
+    {
+      CU_ASSERT(lockfree_queue_pop_front(queue, &value) && value.i == i);
+    }
+  CU_ASSERT_FALSE(lockfree_queue_pop_front(queue, NULL));
+  CU_ASSERT(lockfree_queue_is_empty(queue));
+  lockfree_queue_append(queue, int_elem(7));
+  CU_ASSERT(lockfree_queue_pop_front(queue, NULL));
+  CU_ASSERT(lockfree_queue_is_empty(queue));
+  lockfree_queue_destroy(queue);
+}
+
+/// Shared state of a stress test.
+typedef struct stress
+{
+  lockfree_queue_t *queue;
+  int id;                      // Index of the thread among threads of its kind.
+  atomic_int *seen;            // Number of times every element was removed.
+  atomic_bool *done;           // Set when all producers have finished.
+  atomic_int *out_of_order;    // Number of elements removed before an earlier one of the same producer.
+} stress_t;
+
+static void *produce(void *arg)
+{
+  stress_t *stress = arg;
+  for (int i = 0; i < STRESS_ELEMENTS; ++i)
+    {
+      lockfree_queue_append(stress->queue, int_elem(stress->id * STRESS_ELEMENTS + i));
+    }
+  return NULL;
+}
+
+static void *consume(void *arg)
+{
+  stress_t *stress = arg;
+  int last[STRESS_THREADS];
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      last[t] = -1;
+    }
+  elem_t value;
+  while (true)
+    {
+      const bool finished = atomic_load(stress->done);
+      if (lockfree_queue_pop_front(stress->queue, &value))
+        {
+          atomic_fetch_add(&stress->seen[value.i], 1);
+          // A single consumer sees the elements of every producer in the order they were added.
+          const int producer = value.i / STRESS_ELEMENTS;
+          if (value.i <= last[producer])
+            {
+              atomic_fetch_add(stress->out_of_order, 1);
+            }
+          last[producer] = value.i;
+        }
+      else if (finished)
+        {
+          return NULL;
+        }
+    }
+}
+
+static void *observe(void *arg)
+{
+  stress_t *stress = arg;
+  while (!atomic_load(stress->done))
+    {
+      lockfree_queue_is_empty(stress->queue);
+      lockfree_queue_size(stress->queue);
+    }
+  return NULL;
+}
+
+void test_stress_producers_consumers()
+{
+  lockfree_queue_t *queue = lockfree_queue_create();
+  atomic_int *seen = calloc(STRESS_THREADS * STRESS_ELEMENTS, sizeof(atomic_int));
+  atomic_bool done = false;
+  atomic_int out_of_order = 0;
+  pthread_t producers[STRESS_THREADS];
+  pthread_t consumers[STRESS_THREADS];
+  pthread_t observer;
+  stress_t state[STRESS_THREADS];
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      state[t] = (stress_t) { .queue = queue, .id = t, .seen = seen, .done = &done,
+                              .out_of_order = &out_of_order };
+      pthread_create(&producers[t], NULL, produce, &state[t]);
+      pthread_create(&consumers[t], NULL, consume, &state[t]);
+    }
+  pthread_create(&observer, NULL, observe, &state[0]);
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(producers[t], NULL);
+    }
+  atomic_store(&done, true);
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(consumers[t], NULL);
+    }
+  pthread_join(observer, NULL);
+
+  // Every element was removed exactly once and in order, and the queue is consistent afterwards.
+  int missing = 0;
+  for (int i = 0; i < STRESS_THREADS * STRESS_ELEMENTS; ++i)
+    {
+      missing += atomic_load(&seen[i]) != 1;
+    }
+  CU_ASSERT(missing == 0);
+  CU_ASSERT(atomic_load(&out_of_order) == 0);
+  CU_ASSERT(lockfree_queue_is_empty(queue));
+  CU_ASSERT(lockfree_queue_size(queue) == 0);
+  elem_t value;
+  lockfree_queue_append(queue, int_elem(1));
+  lockfree_queue_append(queue, int_elem(2));
+  CU_ASSERT(lockfree_queue_pop_front(queue, &value) && value.i == 1);
+  CU_ASSERT(lockfree_queue_pop_front(queue, &value) && value.i == 2);
+  free(seen);
+  lockfree_queue_destroy(queue);
+}
+
+int main()
+{
+  if (CUE_SUCCESS != CU_initialize_registry())
+    return CU_get_error();
+
+  CU_pSuite basics = CU_add_suite("Basics", NULL, NULL);
+  CU_pSuite stress = CU_add_suite("Stress", NULL, NULL);
+
+  CU_add_test(basics, "Create And Destroy", test_create_destroy);
+  CU_add_test(basics, "Sequential FIFO", test_sequential_fifo);
+  CU_add_test(stress, "Producers And Consumers", test_stress_producers_consumers);
+
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  CU_cleanup_registry();
+
+  return CU_get_error();
+}
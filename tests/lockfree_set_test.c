@@ -0,0 +1,430 @@
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <CUnit/Basic.h>
+#include "lockfree_set.h"
+
+/// Number of threads of every kind in the stress tests.
+#define STRESS_THREADS 4
+/// Number of operations of every writer in the stress tests.
+#define STRESS_ELEMENTS 20000
+/// Number of keys in the linearizability test.
+#define LIN_KEYS 64
+/// Number of operations of every thread on every key in the linearizability test.
+#define LIN_ROUNDS 32
+/// Number of keys that stay in the set while readers look for them.
+#define STABLE_KEYS 128
+
+/// Operation recorded in a history.
+typedef enum op_kind
+{
+  OP_INSERT,
+  OP_REMOVE,
+  OP_CONTAINS
+} op_kind_t;
+
+/// Operation recorded in a history, with the clock ticks at which it started and returned.
+typedef struct event
+{
+  op_kind_t kind;
+  bool result;
+  long invoke;
+  long response;
+} event_t;
+
+static int compare_int_elements(elem_t a, elem_t b)
+{
+  return (a.i > b.i) - (a.i < b.i);
+}
+
+static int compare_tens(elem_t a, elem_t b)
+{
+  return compare_int_elements(int_elem(a.i / 10), int_elem(b.i / 10));
+}
+
+static bool eq_int_elements(elem_t a, elem_t b)
+{
+  return a.i == b.i;
+}
+
+void test_create_destroy()
+{
+  lockfree_set_t *set = lockfree_set_create(compare_int_elements, NULL);
+  CU_ASSERT_PTR_NOT_NULL(set);
+  CU_ASSERT(lockfree_set_is_empty(set));
+  CU_ASSERT(lockfree_set_size(set) == 0);
+  lockfree_set_destroy(set);
+
+  // Destroying a set that still holds elements frees them as well.
+  set = lockfree_set_create(compare_int_elements, NULL);
+  for (int i = 0; i < 100; ++i)
+    {
+      lockfree_set_insert(set, int_elem(i * 7 % 100));
+    }
+  lockfree_set_destroy(set);
+}
+
+void test_sequential_operations()
+{
+  lockfree_set_t *set = lockfree_set_create(compare_int_elements, NULL);
+  elem_t removed = int_elem(-1);
+  CU_ASSERT_FALSE(lockfree_set_remove(set, int_elem(1), &removed));
+  CU_ASSERT(removed.i == -1);
+  for (int i = 0; i < 100; ++i)
+    {
+      CU_ASSERT(lockfree_set_insert(set, int_elem(i * 37 % 100)));
+    }
+  CU_ASSERT_FALSE(lockfree_set_insert(set, int_elem(37)));
+  CU_ASSERT(lockfree_set_size(set) == 100);
+  for (int i = 0; i < 100; ++i)
+    {
+      CU_ASSERT(lockfree_set_contains(set, int_elem(i)));
+    }
+  CU_ASSERT_FALSE(lockfree_set_contains(set, int_elem(-1)));
+  CU_ASSERT_FALSE(lockfree_set_contains(set, int_elem(100)));
+
+  for (int i = 0; i < 100; i += 2)
+    {
+      CU_ASSERT(lockfree_set_remove(set, int_elem(i), &removed) && removed.i == i);
+    }
+  CU_ASSERT_FALSE(lockfree_set_remove(set, int_elem(0), NULL));
+  CU_ASSERT(lockfree_set_size(set) == 50);
+  for (int i = 0; i < 100; ++i)
+    {
+      CU_ASSERT(lockfree_set_contains(set, int_elem(i)) == (i % 2 == 1));
+    }
+  CU_ASSERT(lockfree_set_insert(set, int_elem(0)));
+  for (int i = 0; i < 100; i += 2)
+    {
+      lockfree_set_remove(set, int_elem(i + 1), NULL);
+    }
+  CU_ASSERT_FALSE(lockfree_set_is_empty(set));
+  CU_ASSERT(lockfree_set_remove(set, int_elem(0), NULL));
+  CU_ASSERT(lockfree_set_is_empty(set));
+  lockfree_set_destroy(set);
+}
+
+void test_equal_order()
+{
+  // Elements are ordered by their tens, and told apart by their value.
+  lockfree_set_t *set = lockfree_set_create(compare_tens, eq_int_elements);
+  CU_ASSERT(lockfree_set_insert(set, int_elem(12)));
+  CU_ASSERT(lockfree_set_insert(set, int_elem(11)));
+  CU_ASSERT(lockfree_set_insert(set, int_elem(25)));
+  CU_ASSERT(lockfree_set_insert(set, int_elem(3)));
+  CU_ASSERT_FALSE(lockfree_set_insert(set, int_elem(11)));
+  CU_ASSERT(lockfree_set_contains(set, int_elem(12)));
+  CU_ASSERT_FALSE(lockfree_set_contains(set, int_elem(13)));
+  elem_t removed;
+  CU_ASSERT(lockfree_set_remove(set, int_elem(12), &removed) && removed.i == 12);
+  CU_ASSERT(lockfree_set_contains(set, int_elem(11)));
+  CU_ASSERT_FALSE(lockfree_set_contains(set, int_elem(12)));
+  CU_ASSERT(lockfree_set_size(set) == 3);
+  lockfree_set_destroy(set);
+
+  // Without an equality function, elements ordered together are equal.
+  set = lockfree_set_create(compare_tens, NULL);
+  CU_ASSERT(lockfree_set_insert(set, int_elem(12)));
+  CU_ASSERT_FALSE(lockfree_set_insert(set, int_elem(11)));
+  CU_ASSERT(lockfree_set_remove(set, int_elem(19), &removed) && removed.i == 12);
+  CU_ASSERT(lockfree_set_is_empty(set));
+  lockfree_set_destroy(set);
+}
+
+/// Shared state of a linearizability test.
+typedef struct history
+{
+  lockfree_set_t *set;
+  int id;                      // Index of the thread.
+  atomic_long *clock;          // Clock ticked before and after every operation.
+  event_t *events;             // Operations of the thread, LIN_ROUNDS for every key in turn.
+} history_t;
+
+static void *record_history(void *arg)
+{
+  history_t *history = arg;
+  unsigned int state = (unsigned int)history->id * 7919 + 1;
+  int keys[LIN_KEYS * LIN_ROUNDS];
+  int rounds[LIN_KEYS] = { 0 };
+  for (int i = 0; i < LIN_KEYS * LIN_ROUNDS; ++i)
+    {
+      keys[i] = i % LIN_KEYS;
+    }
+  for (int i = LIN_KEYS * LIN_ROUNDS - 1; i > 0; --i)
+    {
+      state = state * 1103515245 + 12345;
+      const int j = (int)((state >> 8) % (unsigned int)(i + 1));
+      const int key = keys[i];
+      keys[i] = keys[j];
+      keys[j] = key;
+    }
+
+  for (int i = 0; i < LIN_KEYS * LIN_ROUNDS; ++i)
+    {
+      const int key = keys[i];
+      event_t *event = &history->events[key * LIN_ROUNDS + rounds[key]++];
+      state = state * 1103515245 + 12345;
+      event->kind = (op_kind_t)((state >> 16) % 3);
+      event->invoke = atomic_fetch_add(history->clock, 1);
+      switch (event->kind)
+        {
+        case OP_INSERT:
+          event->result = lockfree_set_insert(history->set, int_elem(key));
+          break;
+        case OP_REMOVE:
+          event->result = lockfree_set_remove(history->set, int_elem(key), NULL);
+          break;
+        case OP_CONTAINS:
+          event->result = lockfree_set_contains(history->set, int_elem(key));
+          break;
+        }
+      event->response = atomic_fetch_add(history->clock, 1);
+    }
+  return NULL;
+}
+
+/// Search state of the linearizability check of a single key.
+typedef struct check
+{
+  event_t *events[STRESS_THREADS]; // Operations of every thread on the key, in program order.
+  unsigned char *failed;           // Search states already known not to lead to a linearization.
+} check_t;
+
+static size_t check_state(const int *done, const bool present)
+{
+  size_t state = 0;
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      state = state * (LIN_ROUNDS + 1) + (size_t)done[t];
+    }
+  return state * 2 + present;
+}
+
+/**
+ * Search for an order of the remaining operations that is consistent with the
+ * order in which they happened and with the result of every operation, after
+ * the first done[t] operations of every thread t have been ordered.
+ **/
+static bool linearizable(check_t *check, int *done, const bool present)
+{
+  const size_t state = check_state(done, present);
+  if (check->failed[state])
+    {
+      return false;
+    }
+  // An operation may go next if it started before every remaining operation returned.
+  long deadline = LONG_MAX;
+  bool finished = true;
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      if (done[t] < LIN_ROUNDS)
+        {
+          finished = false;
+          const long response = check->events[t][done[t]].response;
+          deadline = response < deadline ? response : deadline;
+        }
+    }
+  if (finished)
+    {
+      return true;
+    }
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      if (done[t] == LIN_ROUNDS || check->events[t][done[t]].invoke > deadline)
+        {
+          continue;
+        }
+      const event_t *event = &check->events[t][done[t]];
+      bool after = present;
+      bool valid = false;
+      switch (event->kind)
+        {
+        case OP_INSERT:
+          valid = event->result == !present;
+          after = true;
+          break;
+        case OP_REMOVE:
+          valid = event->result == present;
+          after = false;
+          break;
+        case OP_CONTAINS:
+          valid = event->result == present;
+          break;
+        }
+      if (valid)
+        {
+          ++done[t];
+          const bool success = linearizable(check, done, after);
+          --done[t];
+          if (success)
+            {
+              return true;
+            }
+        }
+    }
+  check->failed[state] = 1;
+  return false;
+}
+
+void test_linearizability()
+{
+  lockfree_set_t *set = lockfree_set_create(compare_int_elements, NULL);
+  atomic_long clock = 0;
+  pthread_t threads[STRESS_THREADS];
+  history_t histories[STRESS_THREADS];
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      histories[t] = (history_t) { .set = set, .id = t, .clock = &clock,
+                                   .events = calloc(LIN_KEYS * LIN_ROUNDS, sizeof(event_t)) };
+      pthread_create(&threads[t], NULL, record_history, &histories[t]);
+    }
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(threads[t], NULL);
+    }
+
+  // The set of keys is linearizable if the history of every single key is.
+  size_t states = 2;
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      states *= LIN_ROUNDS + 1;
+    }
+  check_t check = { .failed = malloc(states) };
+  int failures = 0;
+  size_t present = 0;
+  for (int key = 0; key < LIN_KEYS; ++key)
+    {
+      for (int t = 0; t < STRESS_THREADS; ++t)
+        {
+          check.events[t] = &histories[t].events[key * LIN_ROUNDS];
+        }
+      memset(check.failed, 0, states);
+      int done[STRESS_THREADS] = { 0 };
+      failures += !linearizable(&check, done, false);
+      present += lockfree_set_contains(set, int_elem(key));
+    }
+  CU_ASSERT(failures == 0);
+  CU_ASSERT(lockfree_set_size(set) == present);
+
+  free(check.failed);
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      free(histories[t].events);
+    }
+  lockfree_set_destroy(set);
+}
+
+/// Shared state of a stress test.
+typedef struct stress
+{
+  lockfree_set_t *set;
+  int id;                      // Index of the thread among threads of its kind.
+  atomic_bool *done;           // Set when all writers have finished.
+  atomic_int *misses;          // Number of times a reader got a wrong answer.
+} stress_t;
+
+static void *churn(void *arg)
+{
+  stress_t *stress = arg;
+  unsigned int state = (unsigned int)stress->id + 1;
+  for (int i = 0; i < STRESS_ELEMENTS; ++i)
+    {
+      state = state * 1103515245 + 12345;
+      const int key = 2 * (int)((state >> 16) % STABLE_KEYS) + 1;
+      if (i % 2 == 0)
+        {
+          lockfree_set_insert(stress->set, int_elem(key));
+        }
+      else
+        {
+          lockfree_set_remove(stress->set, int_elem(key), NULL);
+        }
+    }
+  return NULL;
+}
+
+static void *read_stable(void *arg)
+{
+  stress_t *stress = arg;
+  while (!atomic_load(stress->done))
+    {
+      for (int key = 0; key < 2 * STABLE_KEYS; key += 2)
+        {
+          if (!lockfree_set_contains(stress->set, int_elem(key)))
+            {
+              atomic_fetch_add(stress->misses, 1);
+            }
+        }
+      if (lockfree_set_contains(stress->set, int_elem(-1)) || lockfree_set_is_empty(stress->set))
+        {
+          atomic_fetch_add(stress->misses, 1);
+        }
+    }
+  return NULL;
+}
+
+void test_stress_stable_readers()
+{
+  lockfree_set_t *set = lockfree_set_create(compare_int_elements, NULL);
+  for (int key = 0; key < 2 * STABLE_KEYS; key += 2)
+    {
+      lockfree_set_insert(set, int_elem(key));
+    }
+  atomic_bool done = false;
+  atomic_int misses = 0;
+  pthread_t writers[STRESS_THREADS];
+  pthread_t readers[STRESS_THREADS];
+  stress_t state[STRESS_THREADS];
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      state[t] = (stress_t) { .set = set, .id = t, .done = &done, .misses = &misses };
+      pthread_create(&writers[t], NULL, churn, &state[t]);
+      pthread_create(&readers[t], NULL, read_stable, &state[t]);
+    }
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(writers[t], NULL);
+    }
+  atomic_store(&done, true);
+  for (int t = 0; t < STRESS_THREADS; ++t)
+    {
+      pthread_join(readers[t], NULL);
+    }
+
+  // Keys that were never removed were always found, and the set is consistent afterwards.
+  CU_ASSERT(atomic_load(&misses) == 0);
+  for (int key = 1; key < 2 * STABLE_KEYS; key += 2)
+    {
+      lockfree_set_remove(set, int_elem(key), NULL);
+    }
+  CU_ASSERT(lockfree_set_size(set) == STABLE_KEYS);
+  for (int key = 0; key < 2 * STABLE_KEYS; ++key)
+    {
+      CU_ASSERT(lockfree_set_contains(set, int_elem(key)) == (key % 2 == 0));
+    }
+  lockfree_set_destroy(set);
+}
+
+int main()
+{
+  if (CUE_SUCCESS != CU_initialize_registry())
+    return CU_get_error();
+
+  CU_pSuite basics = CU_add_suite("Basics", NULL, NULL);
+  CU_pSuite stress = CU_add_suite("Stress", NULL, NULL);
+
+  CU_add_test(basics, "Create And Destroy", test_create_destroy);
+  CU_add_test(basics, "Sequential Operations", test_sequential_operations);
+  CU_add_test(basics, "Elements Ordered Together", test_equal_order);
+  CU_add_test(stress, "Linearizability", test_linearizability);
+  CU_add_test(stress, "Readers Of Stable Keys", test_stress_stable_readers);
+
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  CU_cleanup_registry();
+
+  return CU_get_error();
+}
@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <CUnit/Basic.h>
+#include "pool.h"
+
+void test_pool_create_destroy()
+{
+  pool_t *pool = pool_create(16, 4);
+  CU_ASSERT_PTR_NOT_NULL(pool);
+  CU_ASSERT(pool_object_size(pool) == 16);
+  pool_destroy(pool);
+}
+
+void test_pool_alloc_distinct()
+{
+  pool_t *pool = pool_create(sizeof(int), 4);
+  int *objects[10];
+  for (int i = 0; i < 10; ++i)
+    {
+      objects[i] = pool_alloc(pool);
+      CU_ASSERT_PTR_NOT_NULL(objects[i]);
+      *objects[i] = i;
+    }
+  for (int i = 0; i < 10; ++i)
+    {
+      CU_ASSERT(*objects[i] == i);
+    }
+  pool_destroy(pool);
+}
+
+void test_pool_free_reuse()
+{
+  pool_t *pool = pool_create(24, 0);
+  void *first = pool_alloc(pool);
+  void *second = pool_alloc(pool);
+  pool_free(pool, first);
+  pool_free(pool, NULL);
+  CU_ASSERT_PTR_EQUAL(pool_alloc(pool), first);
+  pool_free(pool, second);
+  CU_ASSERT_PTR_EQUAL(pool_alloc(pool), second);
+  CU_ASSERT(pool_alloc(pool) != first);
+  pool_destroy(pool);
+}
+
+void test_pool_alloc_many()
+{
+  pool_t *pool = pool_create(12, 2);
+  void *single = pool_alloc(pool);
+  char *run = pool_alloc_many(pool, 100);
+  CU_ASSERT_PTR_NOT_NULL(run);
+  CU_ASSERT(pool_object_stride(pool) >= pool_object_size(pool));
+  for (int i = 0; i < 100; ++i)
+    {
+      *(int *)(run + i * pool_object_stride(pool)) = i;
+    }
+  pool_free(pool, run + 5 * pool_object_stride(pool));
+  CU_ASSERT_PTR_EQUAL(pool_alloc(pool), run + 5 * pool_object_stride(pool));
+  CU_ASSERT(*(int *)(run + 99 * pool_object_stride(pool)) == 99);
+  CU_ASSERT_PTR_NULL(pool_alloc_many(pool, SIZE_MAX / pool_object_stride(pool) + 1));
+  CU_ASSERT_PTR_NULL(pool_alloc_many(pool, (size_t)1 << 60));
+  pool_free(pool, single);
+  pool_destroy(pool);
+}
+
+void test_pool_reset()
+{
+  pool_t *pool = pool_create(sizeof(int), 4);
+  for (int round = 0; round < 3; ++round)
+    {
+      int *objects[10];
+      for (int i = 0; i < 10; ++i)
+        {
+          objects[i] = pool_alloc(pool);
+          CU_ASSERT_PTR_NOT_NULL(objects[i]);
+          *objects[i] = i;
+        }
+      pool_free(pool, objects[3]);
+      CU_ASSERT_PTR_NOT_NULL(pool_alloc_many(pool, 50));
+      for (int i = 0; i < 10; ++i)
+        {
+          CU_ASSERT(i == 3 || *objects[i] == i);
+        }
+      pool_reset(pool);
+    }
+  pool_reset(pool);
+  pool_destroy(pool);
+}
+
+int main()
+{
+  if (CUE_SUCCESS != CU_initialize_registry())
+    return CU_get_error();
+
+  CU_pSuite allocation = CU_add_suite("Allocation", NULL, NULL);
+
+  CU_add_test(allocation, "Pool Creation", test_pool_create_destroy);
+  CU_add_test(allocation, "Distinct Objects", test_pool_alloc_distinct);
+  CU_add_test(allocation, "Reuse Freed Objects", test_pool_free_reuse);
+  CU_add_test(allocation, "Contiguous Runs", test_pool_alloc_many);
+  CU_add_test(allocation, "Reset", test_pool_reset);
+
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  CU_cleanup_registry();
+
+  return CU_get_error();
+}
@@ -0,0 +1,123 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <CUnit/Basic.h>
+#include "thread_pool.h"
+
+/// Number of chunks of the tasks in the tests.
+#define CHUNKS 1000
+
+/// Task that counts how often every chunk ran.
+typedef struct counting
+{
+  atomic_int runs[CHUNKS];
+  thread_pool_t *pool;
+} counting_t;
+
+static void count_chunk(void *arg, const size_t chunk)
+{
+  counting_t *counting = arg;
+  atomic_fetch_add(&counting->runs[chunk], 1);
+}
+
+static int count_wrong(counting_t *counting, const size_t chunks, const int expected)
+{
+  int wrong = 0;
+  for (size_t i = 0; i < CHUNKS; ++i)
+    {
+      wrong += atomic_load(&counting->runs[i]) != (i < chunks ? expected : 0);
+    }
+  return wrong;
+}
+
+void test_create_destroy()
+{
+  thread_pool_t *pool = thread_pool_create(2);
+  CU_ASSERT_PTR_NOT_NULL(pool);
+  CU_ASSERT(thread_pool_threads(pool) == 3);
+  thread_pool_destroy(pool);
+
+  // Without a number of workers, the pool has a thread per processor.
+  pool = thread_pool_create(0);
+  CU_ASSERT_PTR_NOT_NULL(pool);
+  CU_ASSERT(thread_pool_threads(pool) >= 1);
+  thread_pool_destroy(pool);
+}
+
+void test_every_chunk_once()
+{
+  thread_pool_t *pool = thread_pool_create(3);
+  counting_t *counting = calloc(1, sizeof(counting_t));
+  const size_t chunks[] = { 0, 1, 2, 5, CHUNKS };
+  for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); ++i)
+    {
+      for (size_t c = 0; c < CHUNKS; ++c)
+        {
+          atomic_store(&counting->runs[c], 0);
+        }
+      thread_pool_run(pool, count_chunk, counting, chunks[i]);
+      CU_ASSERT(count_wrong(counting, chunks[i], 1) == 0);
+    }
+
+  // The pool can be reused for many tasks in a row.
+  for (size_t c = 0; c < CHUNKS; ++c)
+    {
+      atomic_store(&counting->runs[c], 0);
+    }
+  for (int round = 0; round < 200; ++round)
+    {
+      thread_pool_run(pool, count_chunk, counting, CHUNKS);
+    }
+  CU_ASSERT(count_wrong(counting, CHUNKS, 200) == 0);
+  free(counting);
+  thread_pool_destroy(pool);
+}
+
+static void *run_tasks(void *arg)
+{
+  counting_t *counting = arg;
+  for (int round = 0; round < 50; ++round)
+    {
+      thread_pool_run(counting->pool, count_chunk, counting, CHUNKS);
+    }
+  return NULL;
+}
+
+void test_shared_pool()
+{
+  // Tasks started on the same pool from several threads run one after the other.
+  thread_pool_t *pool = thread_pool_create(2);
+  counting_t *countings = calloc(4, sizeof(counting_t));
+  pthread_t threads[4];
+  for (int t = 0; t < 4; ++t)
+    {
+      countings[t].pool = pool;
+      pthread_create(&threads[t], NULL, run_tasks, &countings[t]);
+    }
+  for (int t = 0; t < 4; ++t)
+    {
+      pthread_join(threads[t], NULL);
+      CU_ASSERT(count_wrong(&countings[t], CHUNKS, 50) == 0);
+    }
+  free(countings);
+  thread_pool_destroy(pool);
+}
+
+int main()
+{
+  if (CUE_SUCCESS != CU_initialize_registry())
+    return CU_get_error();
+
+  CU_pSuite basics = CU_add_suite("Basics", NULL, NULL);
+
+  CU_add_test(basics, "Create And Destroy", test_create_destroy);
+  CU_add_test(basics, "Every Chunk Once", test_every_chunk_once);
+  CU_add_test(basics, "Shared Pool", test_shared_pool);
+
+  CU_basic_set_mode(CU_BRM_VERBOSE);
+  CU_basic_run_tests();
+  CU_cleanup_registry();
+
+  return CU_get_error();
+}